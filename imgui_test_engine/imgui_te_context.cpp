@@ -58,17 +58,69 @@ ImGuiTestRefDesc::ImGuiTestRefDesc(const ImGuiTestRef& ref, const ImGuiTestItemI
 //-------------------------------------------------------------------------
 
 // Helper to increment/decrement the function depth (so our log entry can be padded accordingly)
+// Also account frames and wall time spent in each function, reported by ImGuiTestEngine_PrintResultSummary().
 #define IM_TOKENCONCAT_INTERNAL(x, y)                   x ## y
 #define IM_TOKENCONCAT(x, y)                            IM_TOKENCONCAT_INTERNAL(x, y)
-#define IMGUI_TEST_CONTEXT_REGISTER_DEPTH(_THIS)        ImGuiTestContextDepthScope IM_TOKENCONCAT(depth_register, __LINE__)(_THIS)
+#define IMGUI_TEST_CONTEXT_REGISTER_DEPTH(_THIS)        ImGuiTestContextDepthScope IM_TOKENCONCAT(depth_register, __LINE__)(_THIS, __FUNCTION__)
 
 struct ImGuiTestContextDepthScope
 {
-    ImGuiTestContext* TestContext;
-    ImGuiTestContextDepthScope(ImGuiTestContext* ctx) { TestContext = ctx; TestContext->ActionDepth++; }
-    ~ImGuiTestContextDepthScope() { TestContext->ActionDepth--; }
+    ImGuiTestContext*   TestContext;
+    const char*         Name;
+    int                 FrameStart;
+    ImU64               TimeStart;
+
+    ImGuiTestContextDepthScope(ImGuiTestContext* ctx, const char* name)
+    {
+        TestContext = ctx;
+        Name = name;
+        FrameStart = ctx->FrameCount;
+        TimeStart = ImTimeGetInMicroseconds();
+        if (ctx->ActionDepth++ == 0)
+            ctx->ActionFrameStart = ctx->FrameCount;
+    }
+    ~ImGuiTestContextDepthScope()
+    {
+        ImGuiTestContext* ctx = TestContext;
+        ctx->ActionDepth--;
+        if (ctx->ActiveFunc != ImGuiTestActiveFunc_TestFunc || ctx->TestOutput == nullptr)
+            return;
+
+        // Per function accounting, keyed by function name literal
+        ImGuiTestOutput* output = ctx->TestOutput;
+        const ImGuiID name_key = ImHashData(&Name, sizeof(Name));
+        int stats_idx = output->ActionStatsLookup.GetInt(name_key, -1);
+        if (stats_idx != -1 && output->ActionStats[stats_idx].Name != Name)
+            for (stats_idx = 0; stats_idx < output->ActionStats.Size && output->ActionStats[stats_idx].Name != Name; stats_idx++) {} // Hash collision
+        if (stats_idx == -1 || stats_idx == output->ActionStats.Size)
+        {
+            stats_idx = output->ActionStats.Size;
+            output->ActionStats.push_back(ImGuiTestActionStats());
+            output->ActionStats[stats_idx].Name = Name;
+            if (output->ActionStatsLookup.GetInt(name_key, -1) == -1)
+                output->ActionStatsLookup.SetInt(name_key, stats_idx);
+        }
+        ImGuiTestActionStats* stats = &output->ActionStats[stats_idx];
+        stats->Calls++;
+        stats->Frames += ctx->FrameCount - FrameStart;
+        stats->TimeUs += ImTimeGetInMicroseconds() - TimeStart;
+
+        // Account frames spent by top-level actions (reported as frames/action, see ImGuiTestEngineIO::ConfigFastInputCoalescing)
+        if (ctx->ActionDepth == 0 && ctx->FrameCount > ctx->ActionFrameStart)
+        {
+            ctx->TestOutput->ActionCount++;
+            ctx->TestOutput->ActionFrames += ctx->FrameCount - ctx->ActionFrameStart;
+        }
+    }
 };
 
+// Compressed fast mode (see ImGuiTestEngineIO::ConfigFastInputCoalescing)
+// Requires io.ConfigInputTrickleEventQueue: without it a down+up pair submitted together would be processed in a single frame.
+static bool IsFastInputCoalescing(ImGuiTestContext* ctx)
+{
+    return ctx->EngineIO->ConfigRunSpeed == ImGuiTestRunSpeed_Fast && ctx->EngineIO->ConfigFastInputCoalescing && ctx->UiContext->IO.ConfigInputTrickleEventQueue;
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] Enum names helpers
 //-------------------------------------------------------------------------
@@ -141,6 +193,7 @@ void    ImGuiTestContext::LogExV(ImGuiTestVerboseLevel level, ImGuiTestLogFlags
 
     ImGuiTestLog* log = &ctx->TestOutput->Log;
     const int prev_size = log->Buffer.size();
+    const int alloc_count_start = ctx->UiContext ? ImGuiTestEngine_GetAllocCount(ctx->UiContext) : -1;
 
     //const char verbose_level_char = ImGuiTestEngine_GetVerboseLevelName(level)[0];
     //if (flags & ImGuiTestLogFlags_NoHeader)
@@ -156,6 +209,8 @@ void    ImGuiTestContext::LogExV(ImGuiTestVerboseLevel level, ImGuiTestLogFlags
     log->Buffer.append("\n");
 
     log->UpdateLineOffsets(EngineIO, level, log->Buffer.begin() + prev_size);
+    if (alloc_count_start != -1)
+        Engine->LogAllocCount += ImGuiTestEngine_GetAllocCount(ctx->UiContext) - alloc_count_start;
 
     const char* output_raw = log->Buffer.c_str() + prev_size;
     if (EngineIO->ConfigLogToTTY)
@@ -2401,6 +2456,21 @@ void    ImGuiTestContext::MouseClickMulti(ImGuiMouseButton button, int count)
     // Make sure mouse buttons are released
     IM_ASSERT(count >= 1);
     IM_ASSERT(Inputs->MouseButtonsValue == 0);
+
+    // Compressed fast mode: queue all down/up events at once, trickling will process one button change per frame.
+    if (IsFastInputCoalescing(this))
+    {
+        UiContext->IO.MouseClickedTime[button] = -FLT_MAX; // Prevent accidental double-click from happening ever
+        for (int n = 0; n < count; n++)
+        {
+            Inputs->Queue.push_back(ImGuiTestInput::ForMouseButton(button, true));
+            Inputs->Queue.push_back(ImGuiTestInput::ForMouseButton(button, false));
+        }
+        Yield(count * 2);
+        Yield(); // Let the imgui frame which has seen the last release finish
+        return;
+    }
+
     Yield();
 
     // Press
@@ -2745,6 +2815,19 @@ void    ImGuiTestContext::KeyPress(ImGuiKeyChord key_chord, int count)
     if (EngineIO->ConfigRunSpeed == ImGuiTestRunSpeed_Cinematic)
         SleepShort();
 
+    // Compressed fast mode: queue all down/up events at once, trickling will process one change of a given key per frame.
+    if (IsFastInputCoalescing(this) && count > 0)
+    {
+        for (int n = 0; n < count; n++)
+        {
+            Inputs->Queue.push_back(ImGuiTestInput::ForKeyChord(key_chord, true));
+            Inputs->Queue.push_back(ImGuiTestInput::ForKeyChord(key_chord, false));
+        }
+        Yield(count * 2);
+        Yield(); // Give a frame for items to react
+        return;
+    }
+
     while (count > 0)
     {
         count--;
@@ -2802,6 +2885,62 @@ void    ImGuiTestContext::KeySetEx(ImGuiKeyChord key_chord, bool is_down, float
         SleepNoSkip(time, 1.0f / 100.0f);
 }
 
+// Decode characters once and queue them as a single ImGuiTestInputType_Text input.
+// Return number of frames needed to submit them all (0 if there are no characters).
+static int KeyCharsQueueBatch(ImGuiTestContext* ctx, const char* chars, int chars_per_frame)
+{
+    ImGuiTestInputs* inputs = ctx->Inputs;
+    const int text_offset = inputs->TextChars.Size;
+    while (*chars)
+    {
+        unsigned int c = 0;
+        int bytes_count = ImTextCharFromUtf8(&c, chars, nullptr);
+        chars += bytes_count;
+        if (c > 0 && c <= IM_UNICODE_CODEPOINT_MAX)
+            inputs->TextChars.push_back(c);
+    }
+    const int text_count = inputs->TextChars.Size - text_offset;
+    if (text_count == 0)
+        return 0;
+    inputs->Queue.push_back(ImGuiTestInput::ForText(text_offset, text_count, chars_per_frame));
+    return (chars_per_frame > 0) ? (text_count + chars_per_frame - 1) / chars_per_frame : 1;
+}
+
+// Yield until all queued inputs have been submitted and consumed by Dear ImGui, including events held back by io.ConfigInputTrickleEventQueue.
+static void KeyYieldUntilInputsProcessed(ImGuiTestContext* ctx, int max_frames)
+{
+    for (int n = 0; n < max_frames; n++)
+    {
+        ctx->Yield();
+        if (ctx->Inputs->Queue.Size == 0 && ctx->UiContext->InputEventsQueue.Size == 0)
+            break;
+    }
+    ctx->Yield(); // Give a frame for items to react
+}
+
+// Compressed fast mode: queue key presses and characters of KeyCharsAppend()/KeyCharsReplace() etc. as a single batch.
+// Keys set to ImGuiKey_None are skipped. Trickling preserves ordering between keys and characters.
+static void KeyCharsQueueSequence(ImGuiTestContext* ctx, ImGuiKeyChord key_before, const char* chars, ImGuiKeyChord key_after_1, ImGuiKeyChord key_after_2)
+{
+    int max_frames = 0;
+    ImGuiTestInputs* inputs = ctx->Inputs;
+    const ImGuiKeyChord keys_after[] = { key_after_1, key_after_2 };
+    inputs->Queue.push_back(ImGuiTestInput::ForKeyChord(key_before, true));
+    inputs->Queue.push_back(ImGuiTestInput::ForKeyChord(key_before, false));
+    max_frames += 2;
+    if (chars[0])
+        max_frames += KeyCharsQueueBatch(ctx, chars, ctx->EngineIO->ConfigKeyCharsPerFrame) + 1;
+    for (ImGuiKeyChord key_chord : keys_after)
+    {
+        if (key_chord == ImGuiKey_None)
+            continue;
+        inputs->Queue.push_back(ImGuiTestInput::ForKeyChord(key_chord, true));
+        inputs->Queue.push_back(ImGuiTestInput::ForKeyChord(key_chord, false));
+        max_frames += 2;
+    }
+    KeyYieldUntilInputsProcessed(ctx, max_frames);
+}
+
 void    ImGuiTestContext::KeyChars(const char* chars)
 {
     if (IsError())
@@ -2812,6 +2951,13 @@ void    ImGuiTestContext::KeyChars(const char* chars)
     if (EngineIO->ConfigRunSpeed == ImGuiTestRunSpeed_Cinematic)
         SleepStandard();
 
+    // Fast mode: decode once and submit as a batch (see ImGuiTestEngineIO::ConfigKeyCharsPerFrame)
+    if (EngineIO->ConfigRunSpeed == ImGuiTestRunSpeed_Fast)
+    {
+        Yield(ImMax(KeyCharsQueueBatch(this, chars, EngineIO->ConfigKeyCharsPerFrame), 1));
+        return;
+    }
+
     while (*chars)
     {
         unsigned int c = 0;
@@ -2819,13 +2965,28 @@ void    ImGuiTestContext::KeyChars(const char* chars)
         chars += bytes_count;
         if (c > 0 && c <= IM_UNICODE_CODEPOINT_MAX)
             Inputs->Queue.push_back(ImGuiTestInput::ForChar((ImWchar)c));
-
-        if (EngineIO->ConfigRunSpeed != ImGuiTestRunSpeed_Fast)
-            Sleep(1.0f / EngineIO->TypingSpeed);
+        Sleep(1.0f / EngineIO->TypingSpeed);
     }
     Yield();
 }
 
+// Fast mode: submit 'chars_per_frame' characters per frame (0: all at once), regardless of ImGuiTestEngineIO::ConfigKeyCharsPerFrame.
+// Other modes: same as KeyChars().
+void    ImGuiTestContext::KeyCharsBatch(const char* chars, int chars_per_frame)
+{
+    if (IsError())
+        return;
+
+    IMGUI_TEST_CONTEXT_REGISTER_DEPTH(this);
+    LogDebug("KeyCharsBatch('%s', %d)", chars, chars_per_frame);
+    if (EngineIO->ConfigRunSpeed != ImGuiTestRunSpeed_Fast)
+    {
+        KeyChars(chars);
+        return;
+    }
+    Yield(ImMax(KeyCharsQueueBatch(this, chars, chars_per_frame), 1));
+}
+
 void    ImGuiTestContext::KeyCharsAppend(const char* chars)
 {
     if (IsError())
@@ -2833,6 +2994,11 @@ void    ImGuiTestContext::KeyCharsAppend(const char* chars)
 
     IMGUI_TEST_CONTEXT_REGISTER_DEPTH(this);
     LogDebug("KeyCharsAppend('%s')", chars);
+    if (IsFastInputCoalescing(this))
+    {
+        KeyCharsQueueSequence(this, ImGuiKey_End, chars, ImGuiKey_None, ImGuiKey_None);
+        return;
+    }
     KeyPress(ImGuiKey_End);
     KeyChars(chars);
 }
@@ -2844,6 +3010,11 @@ void    ImGuiTestContext::KeyCharsAppendEnter(const char* chars)
 
     IMGUI_TEST_CONTEXT_REGISTER_DEPTH(this);
     LogDebug("KeyCharsAppendEnter('%s')", chars);
+    if (IsFastInputCoalescing(this))
+    {
+        KeyCharsQueueSequence(this, ImGuiKey_End, chars, ImGuiKey_Enter, ImGuiKey_None);
+        return;
+    }
     KeyPress(ImGuiKey_End);
     KeyChars(chars);
     KeyPress(ImGuiKey_Enter);
@@ -2857,10 +3028,16 @@ void    ImGuiTestContext::KeyCharsReplace(const char* chars)
     IMGUI_TEST_CONTEXT_REGISTER_DEPTH(this);
     LogDebug("KeyCharsReplace('%s')", chars);
 #if IMGUI_VERSION_NUM < 19063
-    KeyPress(ImGuiKey_A | ImGuiMod_Shortcut);
+    const ImGuiKeyChord select_all_chord = ImGuiKey_A | ImGuiMod_Shortcut;
 #else
-    KeyPress(ImGuiKey_A | ImGuiMod_Ctrl);
+    const ImGuiKeyChord select_all_chord = ImGuiKey_A | ImGuiMod_Ctrl;
 #endif
+    if (IsFastInputCoalescing(this))
+    {
+        KeyCharsQueueSequence(this, select_all_chord, chars, chars[0] ? ImGuiKey_None : ImGuiKey_Delete, ImGuiKey_None);
+        return;
+    }
+    KeyPress(select_all_chord);
     if (chars[0])
         KeyChars(chars);
     else
@@ -2875,10 +3052,16 @@ void    ImGuiTestContext::KeyCharsReplaceEnter(const char* chars)
     IMGUI_TEST_CONTEXT_REGISTER_DEPTH(this);
     LogDebug("KeyCharsReplaceEnter('%s')", chars);
 #if IMGUI_VERSION_NUM < 19063
-    KeyPress(ImGuiKey_A | ImGuiMod_Shortcut);
+    const ImGuiKeyChord select_all_chord = ImGuiKey_A | ImGuiMod_Shortcut;
 #else
-    KeyPress(ImGuiKey_A | ImGuiMod_Ctrl);
+    const ImGuiKeyChord select_all_chord = ImGuiKey_A | ImGuiMod_Ctrl;
 #endif
+    if (IsFastInputCoalescing(this))
+    {
+        KeyCharsQueueSequence(this, select_all_chord, chars, chars[0] ? ImGuiKey_None : ImGuiKey_Delete, ImGuiKey_Enter);
+        return;
+    }
+    KeyPress(select_all_chord);
     if (chars[0])
         KeyChars(chars);
     else
@@ -2886,50 +3069,214 @@ void    ImGuiTestContext::KeyCharsReplaceEnter(const char* chars)
     KeyPress(ImGuiKey_Enter);
 }
 
+// Press a sequence of key chords.
+// Compressed fast mode: all down/up events are queued at once and spread by io.ConfigInputTrickleEventQueue. Otherwise same as calling KeyPress() for each.
+void    ImGuiTestContext::KeyPressBatch(const ImGuiKeyChord* key_chords, int count)
+{
+    if (IsError())
+        return;
+
+    IMGUI_TEST_CONTEXT_REGISTER_DEPTH(this);
+    LogDebug("KeyPressBatch(%d keys)", count);
+    if (!IsFastInputCoalescing(this))
+    {
+        for (int n = 0; n < count; n++)
+            KeyPress(key_chords[n]);
+        return;
+    }
+
+    for (int n = 0; n < count; n++)
+    {
+        Inputs->Queue.push_back(ImGuiTestInput::ForKeyChord(key_chords[n], true));
+        Inputs->Queue.push_back(ImGuiTestInput::ForKeyChord(key_chords[n], false));
+    }
+    KeyYieldUntilInputsProcessed(this, count * 2);
+}
+
+bool    ImGuiTestContext::InputReplay(const char* filename)
+{
+    if (IsError())
+        return false;
+
+    IMGUI_TEST_CONTEXT_REGISTER_DEPTH(this);
+    LogDebug("InputReplay('%s')", filename);
+    ImGuiTestInputRecording recording;
+    if (!recording.LoadFromFile(filename))
+    {
+        LogError("Unable to load input recording '%s'", filename);
+        return false;
+    }
+    InputReplay(&recording);
+    return true;
+}
+
+// Each recorded frame is replayed as one or more frames using its recorded delta time.
+// Mouse state is accumulated into Inputs->MousePosValue/MouseButtonsValue, which are only submitted once per frame:
+// when a frame has multiple events for the same mouse state (e.g. a button press and release), we yield in between.
+void    ImGuiTestContext::InputReplay(const ImGuiTestInputRecording* recording)
+{
+    if (IsError())
+        return;
+
+    IMGUI_TEST_CONTEXT_REGISTER_DEPTH(this);
+    LogDebug("InputReplay(%d frames, %d events)", recording->FrameCount, recording->EventCount);
+
+    ImGuiTestInputRecordingReader reader(recording);
+    while (!Abort && reader.ReadFrame())
+    {
+        const int frame_count = ImMax(reader.FrameCount, 1);
+        const float frame_dt = (reader.DeltaTime > 0.0f) ? reader.DeltaTime / frame_count : 0.0f;
+
+        // Idle frames since previous record
+        for (int n = 1; n < frame_count && !Abort; n++)
+        {
+            if (frame_dt > 0.0f)
+                ImGuiTestEngine_SetDeltaTime(Engine, frame_dt);
+            Yield();
+        }
+
+        // Events of last frame
+        int mouse_buttons_changed = 0;
+        bool mouse_pos_changed = false;
+        for (const ImGuiInputEvent& e : reader.Events)
+        {
+            bool yield_before = false;
+            if (e.Type == ImGuiInputEventType_MousePos)
+                yield_before = mouse_pos_changed || mouse_buttons_changed != 0;
+            else if (e.Type == ImGuiInputEventType_MouseButton)
+                yield_before = (mouse_buttons_changed & (1 << e.MouseButton.Button)) != 0;
+            if (yield_before)
+            {
+                Yield();
+                mouse_buttons_changed = 0;
+                mouse_pos_changed = false;
+            }
+
+            switch (e.Type)
+            {
+            case ImGuiInputEventType_MousePos:
+                Inputs->MousePosValue = ImVec2(e.MousePos.PosX, e.MousePos.PosY);
+                mouse_pos_changed = true;
+                break;
+            case ImGuiInputEventType_MouseButton:
+                if (e.MouseButton.Down)
+                    Inputs->MouseButtonsValue |= (1 << e.MouseButton.Button);
+                else
+                    Inputs->MouseButtonsValue &= ~(1 << e.MouseButton.Button);
+                mouse_buttons_changed |= (1 << e.MouseButton.Button);
+                break;
+            case ImGuiInputEventType_MouseWheel:
+                Inputs->MouseWheel += ImVec2(e.MouseWheel.WheelX, e.MouseWheel.WheelY);
+                break;
+            case ImGuiInputEventType_Key:
+                // Skip ImGuiMod_XXX keys: they are derived from e.g. ImGuiKey_LeftCtrl when applying inputs.
+                if ((e.Key.Key & ImGuiMod_Mask_) == 0)
+                    Inputs->Queue.push_back(ImGuiTestInput::ForKeyChord(e.Key.Key, e.Key.Down));
+                break;
+            case ImGuiInputEventType_Text:
+                Inputs->Queue.push_back(ImGuiTestInput::ForChar(e.Text.Char));
+                break;
+            default:
+                break;
+            }
+        }
+        if (frame_dt > 0.0f)
+            ImGuiTestEngine_SetDeltaTime(Engine, frame_dt);
+        Yield();
+    }
+}
+
 // depth = 1 -> immediate child of 'parent' in ID Stack
  // FIXME: Configurable filter for InLayerMask. Perhaps we can expose a GatherItemEx() that takes a ImGuiTestGatherTask struct as input.
 void    ImGuiTestContext::GatherItems(ImGuiTestItemList* out_list, ImGuiTestRef parent, int depth)
 {
-    IM_ASSERT(out_list != nullptr);
+    GatherItemsMulti(&out_list, &parent, 1, depth);
+}
+
+// Gather items of multiple parents during the same frames.
+// Each parent has its own output list. The engine serves all gather tasks with a single walk of the ID Stack per submitted item.
+void    ImGuiTestContext::GatherItemsMulti(ImGuiTestItemList** out_lists, const ImGuiTestRef* parents, int count, int depth)
+{
+    IM_ASSERT(out_lists != nullptr && parents != nullptr && count > 0);
     IM_ASSERT(depth > 0 || depth == -1);
 
     if (IsError())
         return;
 
-    ImGuiTestGatherTask* task = &Engine->GatherTask;
-    IM_ASSERT(task->InParentID == 0);
-    IM_ASSERT(task->LastItemInfo == nullptr);
-
     // Register gather tasks
     if (depth == -1)
         depth = 99;
-    if (parent.ID == 0)
-        parent.ID = GetID(parent);
-    task->InParentID = parent.ID;
-    task->InMaxDepth = depth;
-    task->InLayerMask = (1 << ImGuiNavLayer_Main);
-    task->OutList = out_list;
-
-    // Keep running while gathering
-    // The corresponding hook is ItemAdd() -> ImGuiTestEngineHook_ItemAdd() -> ImGuiTestEngineHook_ItemAdd_GatherTask()
-    const int begin_gather_size = out_list->GetSize();
-    while (true)
+    const short layer_mask = (1 << ImGuiNavLayer_Main);
+    ImVector<ImGuiID> parent_ids;
+    ImVector<int> begin_gather_sizes;
+    for (int n = 0; n < count; n++)
     {
-        const int begin_gather_size_for_frame = out_list->GetSize();
-        Yield();
-        const int end_gather_size_for_frame = out_list->GetSize();
-        if (begin_gather_size_for_frame == end_gather_size_for_frame)
-            break;
+        IM_ASSERT(out_lists[n] != nullptr);
+        parent_ids.push_back(parents[n].ID ? parents[n].ID : GetID(parents[n]));
+        begin_gather_sizes.push_back(out_lists[n]->GetSize());
+    }
+
+    // Returns total number of items in output lists
+    auto get_total_size = [&]() { int total = 0; for (int n = 0; n < count; n++) total += out_lists[n]->GetSize(); return total; };
+
+    int appeared_count = 0;
+    bool use_item_graph = true;
+    for (int n = 0; n < count && use_item_graph; n++)
+    {
+        int parent_appeared_count = 0;
+        use_item_graph = ImGuiTestEngine_GatherItemsFromGraph(Engine, out_lists[n], parent_ids[n], depth, layer_mask, &parent_appeared_count);
+        appeared_count += parent_appeared_count;
+    }
+    if (use_item_graph)
+    {
+        // Read from item graph (IO.ConfigItemGraph): no yield unless some items appeared during last frame,
+        // in which case keep running while gathering as contents may still be growing (e.g. tree node just opened).
+        while (appeared_count > 0 && !IsError())
+        {
+            const int begin_gather_size_for_frame = get_total_size();
+            Yield();
+            appeared_count = 0;
+            for (int n = 0; n < count && use_item_graph; n++)
+            {
+                int parent_appeared_count = 0;
+                use_item_graph = ImGuiTestEngine_GatherItemsFromGraph(Engine, out_lists[n], parent_ids[n], depth, layer_mask, &parent_appeared_count);
+                appeared_count += parent_appeared_count;
+            }
+            if (!use_item_graph || get_total_size() == begin_gather_size_for_frame)
+                break;
+        }
+    }
+    else
+    {
+        ImVector<ImGuiTestGatherTask*> tasks;
+        for (int n = 0; n < count; n++)
+            tasks.push_back(ImGuiTestEngine_GatherTaskAdd(Engine, parent_ids[n], depth, layer_mask, out_lists[n]));
+
+        // Keep running while gathering
+        // The corresponding hook is ItemAdd() -> ImGuiTestEngineHook_ItemAdd() -> ImGuiTestEngineHook_ItemAdd_GatherTask()
+        while (true)
+        {
+            const int begin_gather_size_for_frame = get_total_size();
+            Yield();
+            const int end_gather_size_for_frame = get_total_size();
+            if (begin_gather_size_for_frame == end_gather_size_for_frame)
+                break;
+        }
+
+        for (ImGuiTestGatherTask* task : tasks)
+            ImGuiTestEngine_GatherTaskRemove(Engine, task);
     }
-    const int end_gather_size = out_list->GetSize();
 
     // FIXME-TESTS: To support filter we'd need to process the list here,
     // Because ImGuiTestItemList is a pool (ImVector + map ID->index) we'll need to filter, rewrite, rebuild map
 
-    ImGuiTestItemInfo parent_item = ItemInfo(parent, ImGuiTestOpFlags_NoError);
-    LogDebug("GatherItems from %s, %d deep: found %d items.", ImGuiTestRefDesc(parent, parent_item).c_str(), depth, end_gather_size - begin_gather_size);
-
-    task->Clear();
+    for (int n = 0; n < count; n++)
+    {
+        ImGuiTestRef parent = parents[n];
+        parent.ID = parent_ids[n];
+        ImGuiTestItemInfo parent_item = ItemInfo(parent, ImGuiTestOpFlags_NoError);
+        LogDebug("GatherItems from %s, %d deep: found %d items.", ImGuiTestRefDesc(parent, parent_item).c_str(), depth, out_lists[n]->GetSize() - begin_gather_sizes[n]);
+    }
 }
 
 // Supported values for ImGuiTestOpFlags:
@@ -3116,6 +3463,11 @@ void    ImGuiTestContext::ItemActionAll(ImGuiTestAction action, ImGuiTestRef ref
         }
     }
 
+    // With item graph: later passes don't click again items already clicked by previous passes.
+    // (Other actions skip items which reached the desired state, and retry items which didn't)
+    const bool skip_done_items = (Engine->ItemGraph.FirstFrame != -1) && (action == ImGuiTestAction_Click);
+    ImGuiStorage done_items;
+
     // Find child items
     int actioned_total = 0;
     for (int pass = 0; pass < max_passes; pass++)
@@ -3157,6 +3509,9 @@ void    ImGuiTestContext::ItemActionAll(ImGuiTestAction action, ImGuiTestRef ref
 
             const ImGuiTestItemInfo& item = *items[n];
 
+            if (skip_done_items && done_items.GetBool(item.ID))
+                continue;
+
             if (filter && filter->RequireAllStatusFlags != 0)
                 if ((item.StatusFlags & filter->RequireAllStatusFlags) != filter->RequireAllStatusFlags)
                     continue;
@@ -3181,6 +3536,8 @@ void    ImGuiTestContext::ItemActionAll(ImGuiTestAction action, ImGuiTestRef ref
             case ImGuiTestAction_Click:
                 ItemAction(action, item.ID);
                 actioned_total++;
+                if (skip_done_items && !IsError())
+                    done_items.SetBool(item.ID, true);
                 break;
             case ImGuiTestAction_Check:
                 if ((item.StatusFlags & ImGuiItemStatusFlags_Checkable) && !(item.StatusFlags & ImGuiItemStatusFlags_Checked))
@@ -3246,6 +3603,302 @@ void    ImGuiTestContext::ItemCloseAll(ImGuiTestRef ref_parent, int max_depth, i
     ItemActionAll(ImGuiTestAction_Close, ref_parent, &filter);
 }
 
+// Used by ItemFuzz()
+enum ImGuiTestFuzzActionType
+{
+    ImGuiTestFuzzActionType_Click,
+    ImGuiTestFuzzActionType_ClickRight,
+    ImGuiTestFuzzActionType_DoubleClick,
+    ImGuiTestFuzzActionType_Drag,
+    ImGuiTestFuzzActionType_Input,
+    ImGuiTestFuzzActionType_KeyPress,
+    ImGuiTestFuzzActionType_Wheel,
+    ImGuiTestFuzzActionType_COUNT
+};
+
+struct ImGuiTestFuzzAction
+{
+    ImGuiTestFuzzActionType Type;
+    ImGuiID                 ItemID;
+    ImGuiID                 WindowID;
+    ImVec2                  Delta;                      // For Drag, Wheel
+    int                     KeyIdx;                     // For KeyPress
+    char                    Text[32];                   // For Input
+};
+
+struct ImGuiTestFuzzKey
+{
+    ImGuiKeyChord           KeyChord;
+    const char*             Code;
+};
+
+static const ImGuiTestFuzzKey GFuzzKeys[] =
+{
+    { ImGuiKey_Escape,                  "ImGuiKey_Escape" },
+    { ImGuiKey_Enter,                   "ImGuiKey_Enter" },
+    { ImGuiKey_Tab,                     "ImGuiKey_Tab" },
+    { ImGuiKey_Space,                   "ImGuiKey_Space" },
+    { ImGuiKey_Backspace,               "ImGuiKey_Backspace" },
+    { ImGuiKey_Delete,                  "ImGuiKey_Delete" },
+    { ImGuiKey_LeftArrow,               "ImGuiKey_LeftArrow" },
+    { ImGuiKey_RightArrow,              "ImGuiKey_RightArrow" },
+    { ImGuiKey_UpArrow,                 "ImGuiKey_UpArrow" },
+    { ImGuiKey_DownArrow,               "ImGuiKey_DownArrow" },
+    { ImGuiKey_Home,                    "ImGuiKey_Home" },
+    { ImGuiKey_End,                     "ImGuiKey_End" },
+    { ImGuiKey_PageDown,                "ImGuiKey_PageDown" },
+    { ImGuiMod_Ctrl | ImGuiKey_A,       "ImGuiMod_Ctrl | ImGuiKey_A" },
+    { ImGuiMod_Ctrl | ImGuiKey_C,       "ImGuiMod_Ctrl | ImGuiKey_C" },
+    { ImGuiMod_Ctrl | ImGuiKey_V,       "ImGuiMod_Ctrl | ImGuiKey_V" },
+    { ImGuiMod_Ctrl | ImGuiKey_Z,       "ImGuiMod_Ctrl | ImGuiKey_Z" },
+    { ImGuiMod_Ctrl | ImGuiKey_Tab,     "ImGuiMod_Ctrl | ImGuiKey_Tab" },
+    { ImGuiMod_Shift | ImGuiKey_Tab,    "ImGuiMod_Shift | ImGuiKey_Tab" },
+    { ImGuiKey_LeftAlt,                 "ImGuiKey_LeftAlt" },
+};
+
+// Text fragments for Input actions (including multi-bytes UTF-8 and format specifiers)
+static const char* const GFuzzTextFragments[] = { "a", "Z", "0", "9", "-", ".", " ", "1e9", "%s", "%d", "\\", "\xC3\xA9", "\xE6\x97\xA5" };
+
+// xorshift32: we want sequences to be stable across platforms/runtimes, so not using rand().
+static ImU32 ImGuiTestFuzz_Rand(ImU32* state)
+{
+    ImU32 x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+static float ImGuiTestFuzz_RandFloat(ImU32* state, float v_min, float v_max)
+{
+    return v_min + (ImGuiTestFuzz_Rand(state) & 0xFFFFFF) / (float)0xFFFFFF * (v_max - v_min);
+}
+
+static void ImGuiTestFuzz_LogAction(ImGuiTestContext* ctx, int action_n, const ImGuiTestFuzzAction& action)
+{
+    ImGuiWindow* window = ImGui::FindWindowByID(action.WindowID);
+    const char* window_name = window ? window->Name : "N/A";
+    switch (action.Type)
+    {
+    case ImGuiTestFuzzActionType_Click:         ctx->LogInfo("  /* %04d */ ctx->ItemClick(0x%08X); // in '%s'", action_n, action.ItemID, window_name); break;
+    case ImGuiTestFuzzActionType_ClickRight:    ctx->LogInfo("  /* %04d */ ctx->ItemClick(0x%08X, ImGuiMouseButton_Right); // in '%s'", action_n, action.ItemID, window_name); break;
+    case ImGuiTestFuzzActionType_DoubleClick:   ctx->LogInfo("  /* %04d */ ctx->ItemDoubleClick(0x%08X); // in '%s'", action_n, action.ItemID, window_name); break;
+    case ImGuiTestFuzzActionType_Drag:          ctx->LogInfo("  /* %04d */ ctx->ItemDragWithDelta(0x%08X, ImVec2(%.1ff, %.1ff)); // in '%s'", action_n, action.ItemID, action.Delta.x, action.Delta.y, window_name); break;
+    case ImGuiTestFuzzActionType_Input:         ctx->LogInfo("  /* %04d */ ctx->ItemClick(0x%08X); ctx->KeyChars(\"%s\"); // in '%s'", action_n, action.ItemID, action.Text, window_name); break;
+    case ImGuiTestFuzzActionType_KeyPress:      ctx->LogInfo("  /* %04d */ ctx->KeyPress(%s);", action_n, GFuzzKeys[action.KeyIdx].Code); break;
+    case ImGuiTestFuzzActionType_Wheel:         ctx->LogInfo("  /* %04d */ ctx->MouseMove(0x%08X); ctx->MouseWheelY(%.0ff); // in '%s'", action_n, action.ItemID, action.Delta.y, window_name); break;
+    default: IM_ASSERT(0);
+    }
+}
+
+// Coverage-guided random actions over items of a scope.
+// - Each step gathers live items (via the ItemAdd() gather hook) in one of the scopes, picks an item with a bias toward
+//   items never actioned before, and perform a random action on it using direct mouse teleporting (fast, no aiming).
+// - Windows appearing while fuzzing (e.g. popups, menus, new tools windows) are added as scopes when options->FollowNewWindows is set.
+// - Mouse actions don't use ItemAction() aiming/scrolling logic, so only visible items are considered.
+// Repro: the same seed, starting from the same GUI state, will perform the same sequence of actions.
+// Run with options->ActionsCount = result.FailedAction + 1 to stop right after the failing action.
+ImGuiTestFuzzResult ImGuiTestContext::ItemFuzz(ImGuiTestRef ref_parent, const ImGuiTestFuzzOptions* options)
+{
+    ImGuiTestFuzzOptions default_options;
+    if (options == nullptr)
+        options = &default_options;
+    ImGuiTestFuzzResult result;
+    if (IsError())
+        return result;
+
+    IMGUI_TEST_CONTEXT_REGISTER_DEPTH(this);
+    ImGuiContext& g = *UiContext;
+    const ImU32 seed = options->Seed;
+    LogInfo("ItemFuzz() %s, seed 0x%08X, %d actions", ImGuiTestRefDesc(ref_parent).c_str(), seed, options->ActionsCount);
+
+    ImU32 rng = seed ^ 0x9E3779B9;
+    if (rng == 0)
+        rng = 1;
+
+    // Scopes we are gathering items from
+    ImVector<ImGuiID> scopes;
+    scopes.push_back(ref_parent.ID ? ref_parent.ID : GetID(ref_parent));
+    if (scopes[0] == 0)
+    {
+        IM_ERRORF_NOHDR("%s", "Invalid parent reference for ItemFuzz()");
+        return result;
+    }
+
+    // Coverage
+    ImGuiStorage seen_items;        // ID -> number of times actioned + 1
+    ImGuiStorage seen_windows;      // ID -> 1
+    for (ImGuiWindow* window : g.Windows)
+        if (window->WasActive)
+            seen_windows.SetInt(window->ID, 1); // Windows already visible don't account as coverage, but are not followed either.
+
+    ImVector<ImGuiTestFuzzAction> actions;
+    ImGuiTestItemList items;
+    ImVector<const ImGuiTestItemInfo*> candidates;
+    ImVector<float> candidates_weights;
+    const int errors_recovered_start = ErrorRecoveredCounter;
+    const int frame_start = FrameCount;
+    const ImU64 time_start = ImTimeGetInMicroseconds();
+
+    for (int action_n = 0; action_n < options->ActionsCount; action_n++)
+    {
+        // Prefer top-most popup when one is open, as anything else will generally close it
+        ImGuiID scope_id;
+        if (options->FollowNewWindows && g.OpenPopupStack.Size > 0 && g.OpenPopupStack.back().Window != nullptr)
+            scope_id = g.OpenPopupStack.back().Window->ID;
+        else
+            scope_id = scopes[ImGuiTestFuzz_Rand(&rng) % scopes.Size];
+
+        items.Clear();
+        GatherItems(&items, scope_id, options->MaxDepth);
+        if (IsError())
+            break;
+
+        // Filter candidates, update coverage
+        candidates.resize(0);
+        candidates_weights.resize(0);
+        float total_weight = 0.0f;
+        for (const ImGuiTestItemInfo& item : items)
+        {
+            if (item.ItemFlags & ImGuiItemFlags_Disabled)
+                continue;
+            if (item.RectClipped.GetWidth() <= 0.0f || item.RectClipped.GetHeight() <= 0.0f)
+                continue;
+            int* p_count = seen_items.GetIntRef(item.ID, 0);
+            if (*p_count == 0)
+            {
+                *p_count = 1;
+                result.ItemsSeen++;
+            }
+            const float weight = (*p_count == 1) ? options->NewItemWeight : 1.0f;
+            candidates.push_back(&item);
+            candidates_weights.push_back(weight);
+            total_weight += weight;
+        }
+        if (candidates.Size == 0)
+        {
+            // Scope is gone or empty (e.g. closed window): drop it unless it is our root scope
+            if (scope_id != scopes[0] && scopes.contains(scope_id))
+                scopes.find_erase(scope_id);
+            else if (scopes.Size == 1)
+            {
+                LogWarning("ItemFuzz: no items left to interact with.");
+                break;
+            }
+            Yield();
+            continue;
+        }
+
+        // Pick item
+        float pick = ImGuiTestFuzz_RandFloat(&rng, 0.0f, total_weight);
+        int pick_n = 0;
+        while (pick_n < candidates.Size - 1 && pick >= candidates_weights[pick_n])
+            pick -= candidates_weights[pick_n++];
+        const ImGuiTestItemInfo& item = *candidates[pick_n];
+        (*seen_items.GetIntRef(item.ID, 0))++;
+
+        // Pick action
+        ImGuiTestFuzzAction action;
+        memset(&action, 0, sizeof(action));
+        const ImU32 action_roll = ImGuiTestFuzz_Rand(&rng) % 100;
+        action.Type = (action_roll < 45) ? ImGuiTestFuzzActionType_Click :
+            (action_roll < 50) ? ImGuiTestFuzzActionType_ClickRight :
+            (action_roll < 58) ? ImGuiTestFuzzActionType_DoubleClick :
+            (action_roll < 73) ? ImGuiTestFuzzActionType_Drag :
+            (action_roll < 85) ? ImGuiTestFuzzActionType_Input :
+            (action_roll < 95) ? ImGuiTestFuzzActionType_KeyPress : ImGuiTestFuzzActionType_Wheel;
+        action.ItemID = item.ID;
+        action.WindowID = item.Window ? item.Window->ID : 0;
+        if (action.Type == ImGuiTestFuzzActionType_Drag)
+            action.Delta = ImVec2(ImFloor(ImGuiTestFuzz_RandFloat(&rng, -100.0f, 100.0f)), ImFloor(ImGuiTestFuzz_RandFloat(&rng, -100.0f, 100.0f)));
+        else if (action.Type == ImGuiTestFuzzActionType_Wheel)
+            action.Delta = ImVec2(0.0f, (float)(int)(ImGuiTestFuzz_Rand(&rng) % 7) - 3.0f);
+        else if (action.Type == ImGuiTestFuzzActionType_KeyPress)
+            action.KeyIdx = (int)(ImGuiTestFuzz_Rand(&rng) % IM_COUNTOF(GFuzzKeys));
+        else if (action.Type == ImGuiTestFuzzActionType_Input)
+            for (int fragment_n = 0, fragments_count = 1 + ImGuiTestFuzz_Rand(&rng) % 6; fragment_n < fragments_count; fragment_n++)
+                ImStrncpy(action.Text + strlen(action.Text), GFuzzTextFragments[ImGuiTestFuzz_Rand(&rng) % IM_COUNTOF(GFuzzTextFragments)], IM_COUNTOF(action.Text) - strlen(action.Text));
+        actions.push_back(action);
+
+        // Perform action
+        const ImVec2 pos = item.RectClipped.GetCenter();
+        if (item.Window)
+            MouseSetViewport(item.Window);
+        MouseTeleportToPos(pos);
+        switch (action.Type)
+        {
+        case ImGuiTestFuzzActionType_Click:
+            MouseClick(ImGuiMouseButton_Left);
+            break;
+        case ImGuiTestFuzzActionType_ClickRight:
+            MouseClick(ImGuiMouseButton_Right);
+            break;
+        case ImGuiTestFuzzActionType_DoubleClick:
+            MouseDoubleClick(ImGuiMouseButton_Left);
+            break;
+        case ImGuiTestFuzzActionType_Drag:
+            MouseDown(ImGuiMouseButton_Left);
+            MouseTeleportToPos(pos + action.Delta);
+            MouseUp(ImGuiMouseButton_Left);
+            break;
+        case ImGuiTestFuzzActionType_Input:
+            MouseClick(ImGuiMouseButton_Left);
+            if (g.ActiveId != 0 && g.InputTextState.ID == g.ActiveId)
+                KeyChars(action.Text);
+            break;
+        case ImGuiTestFuzzActionType_KeyPress:
+            KeyPress(GFuzzKeys[action.KeyIdx].KeyChord);
+            break;
+        case ImGuiTestFuzzActionType_Wheel:
+            MouseWheelY(action.Delta.y);
+            break;
+        default:
+            IM_ASSERT(0);
+        }
+        result.ActionsCount++;
+
+        // New windows coverage
+        for (ImGuiWindow* window : g.Windows)
+        {
+            if (!window->WasActive || seen_windows.GetInt(window->ID, 0) != 0)
+                continue;
+            seen_windows.SetInt(window->ID, 1);
+            result.WindowsSeen++;
+            if (options->FollowNewWindows && !(window->Flags & ImGuiWindowFlags_ChildWindow) && !(window->Flags & ImGuiWindowFlags_Tooltip))
+                scopes.push_back(window->ID);
+        }
+
+        // Detect failure
+        result.ErrorsRecovered = ErrorRecoveredCounter - errors_recovered_start;
+        if (IsError() || result.ErrorsRecovered > 0)
+        {
+            result.FailedAction = action_n;
+            break;
+        }
+    }
+
+    result.ActionsHash = ImHashData(actions.Data, (size_t)actions.size_in_bytes());   // Actions are zero-initialized, including padding
+
+    result.FramesCount = FrameCount - frame_start;
+    result.TimeUs = ImTimeGetInMicroseconds() - time_start;
+    const float elapsed = (float)(result.TimeUs / 1000000.0);
+    LogInfo("ItemFuzz: %d actions in %.2f secs (%.0f actions/sec, %.1f frames/action), coverage: %d items, %d new windows.", result.ActionsCount, elapsed, elapsed > 0.0f ? result.ActionsCount / elapsed : 0.0f,
+        result.ActionsCount > 0 ? (float)result.FramesCount / result.ActionsCount : 0.0f, result.ItemsSeen, result.WindowsSeen);
+
+    if (result.FailedAction != -1)
+    {
+        // Log repro as code: same seed will reproduce the whole sequence, last actions are the most likely culprits.
+        const int repro_start = ImMax(0, actions.Size - options->ReproActionsCount);
+        if (!IsError())
+            IM_ERRORF_NOHDR("ItemFuzz: %d error(s) reported by error recovery.", result.ErrorsRecovered);
+        LogInfo("ItemFuzz: failure on action %d. Reproduce with Seed = 0x%08X, ActionsCount = %d. Last %d actions:", result.FailedAction, seed, result.FailedAction + 1, actions.Size - repro_start);
+        for (int action_n = repro_start; action_n < actions.Size; action_n++)
+            ImGuiTestFuzz_LogAction(this, action_n, actions[action_n]);
+    }
+    return result;
+}
+
 void    ImGuiTestContext::ItemInputValue(ImGuiTestRef ref, int value)
 {
     char buf[32];
@@ -4559,10 +5212,30 @@ void    ImGuiTestContext::PerfCapture(const char* category, const char* test_nam
         PerfCalcRef();
     IM_ASSERT(PerfRefDt >= 0.0);
 
+    // Hardware performance counters are sampled by main thread in ImGuiTestEngine_PreNewFrame().
+    // Yield once so the first sample is a full frame.
+    const bool use_perf_counters = EngineIO->ConfigPerfCounters;
+    ImU64 perf_counters_sum[ImPerfCounter_COUNT] = {};
+    // Thread CPU time per phase is sampled by main thread in PreNewFrame/PreRender/PreSwap hooks.
+    const bool use_perf_cpu_time = EngineIO->ConfigPerfCpuTime;
+    if (use_perf_cpu_time)
+    {
+        Engine->PerfCpuTimeActive = true;
+        Engine->PerfCpuTimeBuildMs = Engine->PerfCpuTimeRenderMs = -1.0;
+    }
+    if (use_perf_counters || use_perf_cpu_time)
+    {
+        Engine->PerfCountersActive = use_perf_counters;
+        Yield();
+    }
+
     // Yield for the average to stabilize
     LogDebug("Measuring GUI dt...");
     ImMovingAverage<double> delta_times;
     delta_times.Init(PerfIterations);
+    int perf_counters_frames = 0;
+    double cpu_time_build_sum = 0.0, cpu_time_render_sum = 0.0;
+    int cpu_time_frames = 0;
     for (int n = 0; n < PerfIterations && !Abort; n++)
     {
         Yield();
@@ -4570,7 +5243,22 @@ void    ImGuiTestContext::PerfCapture(const char* category, const char* test_nam
         const double last_present_time_ms = Engine->PerfDtPreSwapToPostSwap.RawValueMs;
         const double dt = (UiContext->IO.DeltaTime * 1000.0f) - last_present_time_ms;
         delta_times.AddSample(dt);
+
+        if (use_perf_counters)
+        {
+            for (int counter_n = 0; counter_n < ImPerfCounter_COUNT; counter_n++)
+                perf_counters_sum[counter_n] += Engine->PerfCountersFrame[counter_n];
+            perf_counters_frames++;
+        }
+        if (use_perf_cpu_time && Engine->PerfCpuTimeBuildMs >= 0.0)
+        {
+            cpu_time_build_sum += Engine->PerfCpuTimeBuildMs;
+            cpu_time_render_sum += Engine->PerfCpuTimeRenderMs;
+            cpu_time_frames++;
+        }
     }
+    Engine->PerfCountersActive = false;
+    Engine->PerfCpuTimeActive = false;
     if (Abort)
         return;
 
@@ -4578,6 +5266,17 @@ void    ImGuiTestContext::PerfCapture(const char* category, const char* test_nam
     double dt_ref_ms = PerfRefDt;
     double dt_delta_ms = (dt_curr - PerfRefDt);
 
+    // Per-frame means of hardware performance counters (0.0 when unavailable)
+    double perf_counters[ImPerfCounter_COUNT] = {};
+    if (use_perf_counters && perf_counters_frames > 0)
+        for (int counter_n = 0; counter_n < ImPerfCounter_COUNT; counter_n++)
+            if (Engine->PerfCounters.IsAvailable((ImPerfCounter)counter_n))
+                perf_counters[counter_n] = (double)perf_counters_sum[counter_n] / perf_counters_frames;
+
+    // Per-frame means of main thread CPU time (0.0 when unavailable)
+    const double cpu_time_build_ms = (cpu_time_frames > 0) ? cpu_time_build_sum / cpu_time_frames : 0.0;
+    const double cpu_time_render_ms = (cpu_time_frames > 0) ? cpu_time_render_sum / cpu_time_frames : 0.0;
+
     const ImBuildInfo* build_info = ImBuildGetCompilationInfo();
 
     // Display results
@@ -4585,12 +5284,60 @@ void    ImGuiTestContext::PerfCapture(const char* category, const char* test_nam
     LogInfo("[PERF] Conditions: Stress x%d, %s, %s, %s, %s, %s",
         PerfStressAmount, build_info->Type, build_info->Cpu, build_info->OS, build_info->Compiler, build_info->Date);
     LogInfo("[PERF] Result: %+6.3f ms (from ref %+6.3f)", dt_delta_ms, dt_ref_ms);
+    if (use_perf_counters && Engine->PerfCounters.IsAnyAvailable())
+    {
+        const double ipc = perf_counters[ImPerfCounter_Cycles] > 0.0 ? perf_counters[ImPerfCounter_Instructions] / perf_counters[ImPerfCounter_Cycles] : 0.0;
+        LogInfo("[PERF] Counters/frame: %.0f instructions, %.0f cycles (IPC %.2f), %.0f cache misses, %.0f branch misses",
+            perf_counters[ImPerfCounter_Instructions], perf_counters[ImPerfCounter_Cycles], ipc, perf_counters[ImPerfCounter_CacheMisses], perf_counters[ImPerfCounter_BranchMisses]);
+    }
+    else if (use_perf_counters)
+    {
+        LogWarning("[PERF] Hardware performance counters are not available on this system.");
+    }
+    if (use_perf_cpu_time && cpu_time_frames > 0)
+        LogInfo("[PERF] CPU time/frame: %.3f ms NewFrame->Render, %.3f ms Render->PreSwap", cpu_time_build_ms, cpu_time_render_ms);
+    else if (use_perf_cpu_time)
+        LogWarning("[PERF] CPU time is not available: unsupported on this system, or app doesn't call ImGuiTestEngine_PreSwap().");
 
     ImGuiPerfToolEntry entry;
     entry.Timestamp = Engine->BatchStartTime;
     entry.Category = category ? category : Test->Category;
     entry.TestName = test_name ? test_name : Test->Name;
+
+    // Stress amount sweep: record result, and fit scaling on last step (ImGuiTestEngineIO::PerfStressSweepSteps)
+    if (Engine->PerfSweepStep >= 0)
+    {
+        const ImGuiID capture_id = ImHashStr(entry.TestName, 0, ImHashStr(entry.Category));
+        Engine->PerfSweepPoints.push_back({ capture_id, PerfStressAmount, dt_delta_ms });
+        if (Engine->PerfSweepStep == Engine->PerfSweepStepsCount - 1)
+        {
+            ImVector<int> stress_amounts;
+            ImVector<double> dt_deltas;
+            for (const ImGuiTestEnginePerfSweepPoint& point : Engine->PerfSweepPoints)
+                if (point.CaptureID == capture_id)
+                {
+                    stress_amounts.push_back(point.PerfStressAmount);
+                    dt_deltas.push_back(point.DtDeltaMs);
+                }
+            if (ImGuiTestEngine_PerfToolFitScaling(stress_amounts.Data, dt_deltas.Data, stress_amounts.Size, &entry.ScalingExponent, &entry.ScalingCostMs))
+            {
+                entry.ScalingPoints = stress_amounts.Size;
+                LogInfo("[PERF] Scaling: %.4f ms per stress unit, exponent %.2f (%d points, x%d..x%d)",
+                    entry.ScalingCostMs, entry.ScalingExponent, stress_amounts.Size, stress_amounts.front(), stress_amounts.back());
+            }
+            else
+            {
+                LogWarning("[PERF] Scaling: not enough usable points to fit (need 2+ positive results).");
+            }
+        }
+    }
     entry.DtDeltaMs = dt_delta_ms;
+    entry.Instructions = perf_counters[ImPerfCounter_Instructions];
+    entry.Cycles = perf_counters[ImPerfCounter_Cycles];
+    entry.CacheMisses = perf_counters[ImPerfCounter_CacheMisses];
+    entry.BranchMisses = perf_counters[ImPerfCounter_BranchMisses];
+    entry.CpuBuildMs = cpu_time_build_ms;
+    entry.CpuRenderMs = cpu_time_render_ms;
     entry.PerfStressAmount = PerfStressAmount;
     entry.GitBranchName = EngineIO->GitBranchName;
     entry.BuildType = build_info->Type;
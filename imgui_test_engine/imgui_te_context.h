@@ -148,6 +148,30 @@ struct IMGUI_API ImGuiTestActionFilter
     ImGuiTestActionFilter() { MaxDepth = -1; MaxPasses = -1; MaxItemCountPerDepth = nullptr; RequireAllStatusFlags = RequireAnyStatusFlags = 0; }
 };
 
+// Options for ItemFuzz()
+struct IMGUI_API ImGuiTestFuzzOptions
+{
+    ImU32                   Seed = 0;                   // Random seed. Same seed and same initial GUI state produce the same sequence of actions.
+    int                     ActionsCount = 1000;        // Number of actions to perform.
+    int                     MaxDepth = -1;              // Max depth of items to consider in each scope (-1: unlimited)
+    float                   NewItemWeight = 8.0f;       // Relative chance of picking an item never actioned before. Other items have a weight of 1.0f.
+    bool                    FollowNewWindows = true;    // Also act on windows/popups appearing while fuzzing (menus, combos, modals, tools windows etc.)
+    int                     ReproActionsCount = 32;     // Number of last actions logged as code on failure.
+};
+
+// Result of ItemFuzz()
+struct IMGUI_API ImGuiTestFuzzResult
+{
+    int                     ActionsCount = 0;           // Number of actions performed
+    int                     ItemsSeen = 0;              // Coverage: number of distinct item IDs seen
+    int                     WindowsSeen = 0;            // Coverage: number of distinct windows seen
+    int                     ErrorsRecovered = 0;        // Number of errors reported by error recovery during fuzzing
+    int                     FailedAction = -1;          // Index of action which led to an error (assert, failed check, recovered error) or -1
+    ImGuiID                 ActionsHash = 0;            // Hash of the sequence of actions performed (type, item, parameters): same seed and same initial GUI state give the same hash
+    int                     FramesCount = 0;            // Number of frames elapsed: each action takes several frames (gathering items, then performing action)
+    ImU64                   TimeUs = 0;                 // Wall time elapsed. Throughput is ActionsCount / TimeUs, and is bounded by frame rate / (FramesCount / ActionsCount)
+};
+
 //-------------------------------------------------------------------------
 // [SECTION] ImGuiTestGenericVars, ImGuiTestGenericItemStatus
 //-------------------------------------------------------------------------
@@ -246,8 +270,10 @@ struct IMGUI_API ImGuiTestContext
     ImGuiTestActiveFunc     ActiveFunc = ImGuiTestActiveFunc_None;  // None/GuiFunc/TestFunc
     double                  RunningTime = 0.0;                      // Amount of wall clock time the Test has been running. Used by safety watchdog.
     int                     ActionDepth = 0;                        // Nested depth of ctx-> function calls (used to decorate log)
+    int                     ActionFrameStart = 0;                   // FrameCount when current top-level ctx-> function was called (used to count frames per action)
     int                     CaptureCounter = 0;                     // Number of captures
     int                     ErrorCounter = 0;                       // Number of errors (generally this maxxes at 1 as most functions will early out)
+    int                     ErrorRecoveredCounter = 0;              // Number of errors reported by error recovery (see ImGuiTestEngine_ErrorRecoverySetup())
     bool                    Abort = false;
     double                  PerfRefDt = -1.0;
     int                     PerfIterations = 400;                   // Number of frames for PerfCapture() measurements
@@ -332,6 +358,8 @@ struct IMGUI_API ImGuiTestContext
 
     // Get hash for a decorated ID Path.
     // Note: for windows you may use WindowInfo()
+    // Note: for absolute paths known at compile-time, ImHashDecoratedPathConstexpr() assigned to a constexpr variable has no runtime cost.
+    // (Called in a non-constant expression, it is a regular runtime hash, slower than ImHashDecoratedPath())
     ImGuiID     GetID(ImGuiTestRef ref);
     ImGuiID     GetID(ImGuiTestRef ref, ImGuiTestRef seed_ref);
 
@@ -379,14 +407,22 @@ struct IMGUI_API ImGuiTestContext
     void        KeyDown(ImGuiKeyChord key_chord);
     void        KeyUp(ImGuiKeyChord key_chord);
     void        KeyPress(ImGuiKeyChord key_chord, int count = 1);
+    void        KeyPressBatch(const ImGuiKeyChord* key_chords, int count); // Press a sequence of key chords (queued together in compressed fast mode)
     void        KeyHold(ImGuiKeyChord key_chord, float time);
     void        KeySetEx(ImGuiKeyChord key_chord, bool is_down, float time);
     void        KeyChars(const char* chars);                // Input characters
+    void        KeyCharsBatch(const char* chars, int chars_per_frame = 0); // Input characters, in Fast mode submitted 'chars_per_frame' per frame (0: all at once)
     void        KeyCharsAppend(const char* chars);          // Input characters at end of field
     void        KeyCharsAppendEnter(const char* chars);     // Input characters at end of field, press Enter
     void        KeyCharsReplace(const char* chars);         // Delete existing field then input characters
     void        KeyCharsReplaceEnter(const char* chars);    // Delete existing field then input characters, press Enter
 
+    // Inputs replay
+    // - Replay inputs recorded with ImGuiTestEngine_InputRecordBegin()/ImGuiTestEngine_InputRecordEnd().
+    // - Recorded frames are replayed with their recorded delta time, without waiting on wall clock (as fast as the run speed allows).
+    bool        InputReplay(const char* filename);          // Return false if recording couldn't be loaded
+    void        InputReplay(const ImGuiTestInputRecording* recording);
+
     // Navigation inputs
     // FIXME: Need some redesign/refactoring:
     // - This was initially intended to: replace mouse action with keyboard/gamepad
@@ -419,6 +455,7 @@ struct IMGUI_API ImGuiTestContext
     ImGuiID             ItemInfoHandleWildcardSearch(const char* wildcard_prefix_start, const char* wildcard_prefix_end, const char* wildcard_suffix_start);
     ImGuiTestItemInfo   ItemInfoNull() { return ImGuiTestItemInfo(); }
     void                GatherItems(ImGuiTestItemList* out_list, ImGuiTestRef parent, int depth = -1);
+    void                GatherItemsMulti(ImGuiTestItemList** out_lists, const ImGuiTestRef* parents, int count, int depth = -1); // Gather items of several parents in the same frames
 
     // Item/Widgets manipulation
     void        ItemAction(ImGuiTestAction action, ImGuiTestRef ref, ImGuiTestOpFlags flags = 0, void* action_arg = nullptr);
@@ -436,6 +473,12 @@ struct IMGUI_API ImGuiTestContext
     void        ItemOpenAll(ImGuiTestRef ref_parent, int depth = -1, int passes = -1);
     void        ItemCloseAll(ImGuiTestRef ref_parent, int depth = -1, int passes = -1);
 
+    // Item/Widgets: Fuzzing
+    // - Perform random actions (click, drag, text input, key chords, wheel) on items gathered from a given scope, driven by a seeded RNG.
+    // - Items and windows which were never seen before are treated as coverage and favored, to bias exploration.
+    // - Stop on first assert, failed check or recovered error, and log seed + last actions as code to reproduce.
+    ImGuiTestFuzzResult ItemFuzz(ImGuiTestRef ref_parent, const ImGuiTestFuzzOptions* options = nullptr);
+
     // Item/Widgets: Helpers to easily set a value
     void        ItemInputValue(ImGuiTestRef ref, int v);
     void        ItemInputValue(ImGuiTestRef ref, float f);
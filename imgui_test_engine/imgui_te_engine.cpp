@@ -31,6 +31,15 @@
 #include <signal.h>     // signal()
 #endif
 #include <unistd.h>     // sleep()
+#if (defined(__linux) || defined(__linux__)) && !IMGUI_TEST_ENGINE_IS_GAME_CONSOLE
+#define IMGUI_TEST_ENGINE_HAS_FORK 1
+#include <sys/wait.h>   // waitpid()
+#include <poll.h>       // poll()
+#include <errno.h>
+#endif
+#endif
+#ifndef IMGUI_TEST_ENGINE_HAS_FORK
+#define IMGUI_TEST_ENGINE_HAS_FORK 0
 #endif
 
 // Warnings
@@ -56,6 +65,7 @@ Index of this file:
 // [SECTION] CRASH HANDLING
 // [SECTION] HOOKS FOR CORE LIBRARY
 // [SECTION] CHECK/ERROR FUNCTIONS FOR TESTS
+// [SECTION] INPUT RECORDING
 // [SECTION] SETTINGS
 // [SECTION] ImGuiTestLog
 // [SECTION] ImGuiTest
@@ -77,6 +87,12 @@ static void ImGuiTestEngine_CoroutineStopAndJoin(ImGuiTestEngine* engine);
 static void ImGuiTestEngine_ClearInput(ImGuiTestEngine* engine);
 static void ImGuiTestEngine_ApplyInputToImGuiContext(ImGuiTestEngine* engine);
 static void ImGuiTestEngine_ProcessTestQueue(ImGuiTestEngine* engine);
+#if IMGUI_TEST_ENGINE_HAS_FORK
+static bool ImGuiTestEngine_IsForkBatchRunning(ImGuiTestEngine* engine);
+static void ImGuiTestEngine_UpdateForkedTests(ImGuiTestEngine* engine);
+static void ImGuiTestEngine_ForkKillRunningChild(ImGuiTestEngine* engine);
+static void ImGuiTestEngine_ForkChildSendOutputAndExit(ImGuiTestEngine* engine);
+#endif
 static void ImGuiTestEngine_ClearTests(ImGuiTestEngine* engine);
 static void ImGuiTestEngine_PreNewFrame(ImGuiTestEngine* engine, ImGuiContext* ui_ctx);
 static void ImGuiTestEngine_PostNewFrame(ImGuiTestEngine* engine, ImGuiContext* ui_ctx);
@@ -108,6 +124,10 @@ static void  ImGuiTestEngine_SettingsWriteAll(ImGuiContext* imgui_ctx, ImGuiSett
 // - ImGuiTestEngine_QueueAllTests()
 //-------------------------------------------------------------------------
 // - ImGuiTestEngine_FindItemInfo()
+// - ImGuiTestEngine_GatherTaskAdd()
+// - ImGuiTestEngine_GatherTaskRemove()
+// - ImGuiTestEngine_GatherItemsFromGraph()
+// - ImGuiTestEngine_ItemGraphGarbageCollect()
 // - ImGuiTestEngine_ClearTests()
 // - ImGuiTestEngine_ApplyInputToImGuiContext()
 // - ImGuiTestEngine_PreNewFrame()
@@ -123,6 +143,7 @@ ImGuiTestEngine::ImGuiTestEngine()
     PerfTool = IM_NEW(ImGuiPerfTool);
     UiFilterTests = IM_NEW(Str256); // We bite the bullet of adding an extra alloc/indirection in order to avoid including Str.h in our header
     UiFilterPerfs = IM_NEW(Str256);
+    UiLogSearch = IM_NEW(Str256);
 
     // Initialize std::thread based coroutine implementation if requested
 #if IMGUI_TEST_ENGINE_ENABLE_COROUTINE_STDTHREAD_IMPL
@@ -134,9 +155,13 @@ ImGuiTestEngine::ImGuiTestEngine()
 ImGuiTestEngine::~ImGuiTestEngine()
 {
     IM_ASSERT(TestQueueCoroutine == nullptr);
+    IM_ASSERT(TestContextPoolUsed == 0 && UserVarsArenaUsed == 0);
+    for (ImGuiTestContext* ctx : TestContextPool)
+        IM_DELETE(ctx);
     IM_DELETE(PerfTool);
     IM_DELETE(UiFilterTests);
     IM_DELETE(UiFilterPerfs);
+    IM_DELETE(UiLogSearch);
 }
 
 // Using named functions here instead of lambda gives nicer call-stacks (mostly because we frequently step in PostNewFrame)
@@ -254,10 +279,17 @@ void    ImGuiTestEngine_DestroyContext(ImGuiTestEngine* engine)
         ImGuiTestEngine_UnbindImGuiContext(engine, engine->UiContextTarget);
 
     ImGuiTestEngine_ClearTests(engine);
+    ImGuiTestEngine_InputRecordEnd(engine, nullptr);
 
     for (int n = 0; n < engine->InfoTasks.Size; n++)
         IM_DELETE(engine->InfoTasks[n]);
     engine->InfoTasks.clear();
+    for (int n = 0; n < engine->GatherTasks.Size; n++)
+        IM_DELETE(engine->GatherTasks[n]);
+    engine->GatherTasks.clear();
+    for (int n = 0; n < engine->GatherTasksPool.Size; n++)
+        IM_DELETE(engine->GatherTasksPool[n]);
+    engine->GatherTasksPool.clear();
 
     IM_DELETE(engine);
 
@@ -291,6 +323,9 @@ void    ImGuiTestEngine_Stop(ImGuiTestEngine* engine)
     IM_ASSERT(engine->UiContextTarget != NULL);
 
     engine->Abort = true;
+#if IMGUI_TEST_ENGINE_HAS_FORK
+    ImGuiTestEngine_ForkKillRunningChild(engine);
+#endif
     ImGuiTestEngine_CoroutineStopAndJoin(engine);
     //ImGuiTestEngine_UnbindImGuiContext(engine, engine->UiContextTarget);
     ImGuiTestEngine_Export(engine);
@@ -396,6 +431,14 @@ void    ImGuiTestEngine_PreSwap(ImGuiTestEngine* engine)
     engine->PerfDtPreNewFrameToPreRender.UpdateValueForCurrentFrame((double)(engine->PerfTimestampPreRender - engine->PerfTimestampPreNewFrame) / 1000);
     engine->PerfDtPreRenderToPreSwap.UpdateValueForCurrentFrame((double)(engine->PerfTimestampPreSwap - engine->PerfTimestampPreRender) / 1000);
     engine->PerfDtPreNewFrameToPreSwap.UpdateValueForCurrentFrame((double)(engine->PerfTimestampPreSwap - engine->PerfTimestampPreNewFrame) / 1000);
+
+    // Thread CPU time per phase. Excludes time where main thread was blocked or preempted (e.g. waiting on GPU or vsync).
+    ImU64 cpu_time_pre_swap = 0;
+    if (engine->PerfCpuTimeActive && engine->PerfCpuTimePreNewFrame != 0 && engine->PerfCpuTimePreRender != 0 && ImTimeGetThreadCpuTimeInMicroseconds(&cpu_time_pre_swap))
+    {
+        engine->PerfCpuTimeBuildMs = (double)(engine->PerfCpuTimePreRender - engine->PerfCpuTimePreNewFrame) / 1000;
+        engine->PerfCpuTimeRenderMs = (double)(cpu_time_pre_swap - engine->PerfCpuTimePreRender) / 1000;
+    }
 }
 
 void    ImGuiTestEngine_PostSwap(ImGuiTestEngine* engine)
@@ -524,6 +567,157 @@ ImGuiTestItemInfo* ImGuiTestEngine_FindItemInfo(ImGuiTestEngine* engine, ImGuiID
     return nullptr;
 }
 
+static void ImGuiTestEngine_UpdateGatherTasksLookup(ImGuiTestEngine* engine)
+{
+    engine->GatherTasksParentIds.Clear();
+    engine->GatherTasksParentMask = 0;
+    engine->GatherTasksMaxDepth = 0;
+    for (ImGuiTestGatherTask* task : engine->GatherTasks)
+    {
+        engine->GatherTasksParentIds.SetInt(task->InParentID, 1);
+        engine->GatherTasksParentMask |= (ImU64)1 << (task->InParentID & 63);
+        engine->GatherTasksMaxDepth = ImMax(engine->GatherTasksMaxDepth, task->InMaxDepth);
+    }
+}
+
+// Register a gather task: items submitted under 'parent_id' will be added to 'out_list' until the task is removed.
+// Multiple tasks (including with same parent) may be active at the same time, but they need distinct output lists.
+ImGuiTestGatherTask* ImGuiTestEngine_GatherTaskAdd(ImGuiTestEngine* engine, ImGuiID parent_id, int max_depth, short layer_mask, ImGuiTestItemList* out_list)
+{
+    IM_ASSERT(parent_id != 0 && max_depth > 0 && out_list != nullptr);
+    for (ImGuiTestGatherTask* other_task : engine->GatherTasks)
+        IM_ASSERT(other_task->OutList != out_list && "Gather tasks cannot share an output list!");
+
+    ImGuiTestGatherTask* task;
+    if (engine->GatherTasksPool.Size > 0)
+    {
+        task = engine->GatherTasksPool.back();
+        engine->GatherTasksPool.pop_back();
+    }
+    else
+    {
+        task = IM_NEW(ImGuiTestGatherTask)();
+    }
+    task->Clear();
+    task->InParentID = parent_id;
+    task->InMaxDepth = max_depth;
+    task->InLayerMask = layer_mask;
+    task->OutList = out_list;
+    engine->GatherTasks.push_back(task);
+    ImGuiTestEngine_UpdateGatherTasksLookup(engine);
+    return task;
+}
+
+void ImGuiTestEngine_GatherTaskRemove(ImGuiTestEngine* engine, ImGuiTestGatherTask* task)
+{
+    IM_ASSERT(engine->GatherTasks.contains(task));
+    engine->GatherTasks.find_erase(task);
+    engine->GatherTasksPool.push_back(task);
+    ImGuiTestEngine_UpdateGatherTasksLookup(engine);
+}
+
+static int ItemGraphComparerBySubmitOrder(const void* lhs, const void* rhs)
+{
+    const ImGuiTestItemGraphItem* a = *(const ImGuiTestItemGraphItem* const*)lhs;
+    const ImGuiTestItemGraphItem* b = *(const ImGuiTestItemGraphItem* const*)rhs;
+    return a->SubmitOrder - b->SubmitOrder;
+}
+
+// Equivalent of a GatherTask for items submitted during last frame, without yielding.
+// Depth rules are the same as ImGuiTestEngineHook_ItemAdd_GatherTask().
+// Return false when the graph is disabled or doesn't hold a full frame yet.
+bool ImGuiTestEngine_GatherItemsFromGraph(ImGuiTestEngine* engine, ImGuiTestItemList* out_list, ImGuiID parent_id, int max_depth, short layer_mask, int* out_appeared_count)
+{
+    ImGuiTestItemGraph* graph = &engine->ItemGraph;
+    const int frame_count = graph->SubmitFrame;
+    if (!graph->IsReady(frame_count) || frame_count != engine->FrameCount)
+        return false;
+
+    ImVector<ImGuiTestItemGraphItem*> results;
+    int appeared_count = 0;
+    for (int map_n = 0; map_n < graph->Items.GetMapSize(); map_n++)
+    {
+        ImGuiTestItemGraphItem* graph_item = graph->Items.TryGetMapData(map_n);
+        if (graph_item == nullptr || graph_item->Info.TimestampMain != frame_count)
+            continue;
+        const ImGuiTestItemInfo& info = graph_item->Info;
+        if ((layer_mask & (1 << info.NavLayer)) == 0)
+            continue;
+
+        int result_depth = -1;
+        if (info.ParentID == parent_id)
+        {
+            result_depth = 0;
+        }
+        else
+        {
+            // When using a 'PushID(label); Widget(""); PopID();` pattern flatten as 1 deep instead of 2 for simplicity.
+            int curr_depth = (info.ID == info.ParentID) ? -1 : 0;
+            for (ImGuiID curr_id = info.ParentID; curr_id != 0 && curr_depth < max_depth; curr_depth++)
+            {
+                if (curr_id == parent_id)
+                {
+                    result_depth = curr_depth;
+                    break;
+                }
+                ImGuiTestItemGraphLink* link = graph->Links.GetByKey(curr_id);
+                if (link == nullptr || link->LinkFrame != frame_count)
+                    break;
+                curr_id = link->ParentID;
+            }
+        }
+        if (result_depth == -1)
+            continue;
+
+        graph_item->Info.Depth = result_depth;
+        results.push_back(graph_item);
+        if (graph_item->AppearFrame == frame_count)
+            appeared_count++;
+    }
+
+    if (results.Size > 1)
+        ImQsort(results.Data, (size_t)results.Size, sizeof(ImGuiTestItemGraphItem*), ItemGraphComparerBySubmitOrder);
+    out_list->Reserve(out_list->GetSize() + results.Size);
+    for (ImGuiTestItemGraphItem* graph_item : results)
+        *out_list->Pool.GetOrAddByKey(graph_item->Info.ID) = graph_item->Info;
+
+    if (out_appeared_count)
+        *out_appeared_count = appeared_count;
+    return true;
+}
+
+// Rebuild pool with entries for which keep_func() returns true.
+// (ImPool::Remove() leaves a stale entry in the map for each removed key, so the map would keep growing with every ID ever seen)
+template<typename T, typename FUNC>
+static void ItemGraphCompactPool(ImPool<T>& pool, FUNC keep_func)
+{
+    ImPool<T> new_pool;
+    new_pool.Reserve(pool.GetAliveCount());
+    for (int map_n = 0; map_n < pool.GetMapSize(); map_n++)
+        if (T* data = pool.TryGetMapData(map_n))
+            if (keep_func(*data))
+            {
+                new_pool.Map.Data.push_back(ImGuiStoragePair(pool.Map.Data[map_n].key, new_pool.Buf.Size)); // Map is iterated in key order: stays sorted
+                new_pool.Buf.push_back(*data);
+            }
+    new_pool.FreeIdx = new_pool.AliveCount = new_pool.Buf.Size;
+    pool.Buf.swap(new_pool.Buf);                            // Previous contents are destructed with new_pool
+    pool.Map.Data.swap(new_pool.Map.Data);
+    ImSwap(pool.FreeIdx, new_pool.FreeIdx);
+    ImSwap(pool.AliveCount, new_pool.AliveCount);
+}
+
+// Remove items and links which haven't been submitted for a while, so the graph doesn't grow unbounded over a long batch of tests.
+static void ImGuiTestEngine_ItemGraphGarbageCollect(ImGuiTestEngine* engine)
+{
+    const int ITEM_GRAPH_ELAPSE_FRAMES = 60;
+    ImGuiTestItemGraph* graph = &engine->ItemGraph;
+    const int frame_min = engine->FrameCount - ITEM_GRAPH_ELAPSE_FRAMES;
+    ItemGraphCompactPool(graph->Items, [frame_min](const ImGuiTestItemGraphItem& graph_item) { return graph_item.Info.TimestampMain >= frame_min; });
+    ItemGraphCompactPool(graph->Links, [frame_min](const ImGuiTestItemGraphLink& link) { return link.LinkFrame >= frame_min; });
+    graph->LastItem = nullptr;
+}
+
 static void ImGuiTestEngine_ClearTests(ImGuiTestEngine* engine)
 {
     for (int n = 0; n < engine->TestsAll.Size; n++)
@@ -541,6 +735,7 @@ void ImGuiTestEngine_ClearInput(ImGuiTestEngine* engine)
 
     engine->Inputs.MouseButtonsValue = 0;
     engine->Inputs.Queue.clear();
+    engine->Inputs.TextChars.clear();
     engine->Inputs.MouseWheel = ImVec2(0, 0);
 
     // FIXME: Necessary?
@@ -637,7 +832,8 @@ void ImGuiTestEngine_ApplyInputToImGuiContext(ImGuiTestEngine* engine)
     // Process input requests/queues
     if (engine->Inputs.Queue.Size > 0)
     {
-        for (int n = 0; n < engine->Inputs.Queue.Size; n++)
+        int queue_stalled_n = -1; // Index of an input which needs more frames. It and following inputs are kept in queue.
+        for (int n = 0; n < engine->Inputs.Queue.Size && queue_stalled_n == -1; n++)
         {
             const ImGuiTestInput& input = engine->Inputs.Queue[n];
             switch (input.Type)
@@ -711,6 +907,36 @@ void ImGuiTestEngine_ApplyInputToImGuiContext(ImGuiTestEngine* engine)
                 io.AddInputCharacter(input.Char);
                 break;
             }
+            case ImGuiTestInputType_Text:
+            {
+                // Batch of decoded characters, submitted TextCharsPerFrame at a time. Following inputs wait for the batch to complete.
+                ImGuiTestInput& text_input = engine->Inputs.Queue[n];
+                const int submit_count = (text_input.TextCharsPerFrame > 0) ? ImMin(text_input.TextCharsPerFrame, text_input.TextCount) : text_input.TextCount;
+                for (int char_n = 0; char_n < submit_count; char_n++)
+                    io.AddInputCharacter(engine->Inputs.TextChars[text_input.TextOffset + char_n]);
+                text_input.TextOffset += submit_count;
+                text_input.TextCount -= submit_count;
+                if (text_input.TextCount > 0)
+                    queue_stalled_n = n;
+                break;
+            }
+            case ImGuiTestInputType_MouseButton:
+            {
+                // Explicit button events are used by ImGuiTestEngineIO::ConfigFastInputCoalescing: they are submitted after the state-based
+                // ones above (which are then no-op) and io.ConfigInputTrickleEventQueue spreads a down+up pair over consecutive frames.
+                IM_ASSERT(input.MouseButton >= 0 && input.MouseButton < ImGuiMouseButton_COUNT);
+                const bool down = input.Down;
+                io.AddMouseButtonEvent(input.MouseButton, down);
+#ifdef IMGUI_HAS_VIEWPORT
+                if (down && mouse_hovered_viewport && !mouse_hovered_viewport_focused)
+                    if (io.ConfigFlags & ImGuiConfigFlags_ViewportsEnable)
+                    {
+                        mouse_hovered_viewport_focused = true;
+                        engine->Inputs.Queue.push_back(ImGuiTestInput::ForViewportFocus(mouse_hovered_viewport->ID)); // May invalidate 'input'
+                    }
+#endif
+                break;
+            }
 #ifdef IMGUI_HAS_VIEWPORT
             case ImGuiTestInputType_ViewportFocus:
             {
@@ -780,7 +1006,15 @@ void ImGuiTestEngine_ApplyInputToImGuiContext(ImGuiTestEngine* engine)
             }
         }
 
-        engine->Inputs.Queue.resize(0);
+        if (queue_stalled_n != -1)
+        {
+            engine->Inputs.Queue.erase(engine->Inputs.Queue.Data, engine->Inputs.Queue.Data + queue_stalled_n);
+        }
+        else
+        {
+            engine->Inputs.Queue.resize(0);
+            engine->Inputs.TextChars.resize(0);
+        }
     }
 
     const int input_event_count_curr = g.InputEventsQueue.Size;
@@ -831,9 +1065,37 @@ static void ImGuiTestEngine_PreNewFrame(ImGuiTestEngine* engine, ImGuiContext* u
     IM_ASSERT(ui_ctx == GImGui);
     ImGuiContext& g = *ui_ctx;
 
+#if IMGUI_TEST_ENGINE_HAS_FORK
+    // Fork isolation: run queued tests in child processes, one per frame at most (test queue coroutine is idle here when tests are queued but not running)
+    if (engine->ForkChildPipe == -1 && engine->Started && (ImGuiTestEngine_IsForkBatchRunning(engine) || (engine->IO.ConfigForkIsolation && engine->TestsQueue.Size > 0 && !engine->IO.IsRunningTests && engine->TestContext == nullptr)))
+        ImGuiTestEngine_UpdateForkedTests(engine);
+#endif
+
     // Time measurements
     engine->PerfDtApp.UpdateValueForCurrentFrame(g.IO.DeltaTime * 1000.0f);
     engine->PerfTimestampPreNewFrame = ImTimeGetInMicroseconds();
+    engine->PerfCpuTimePreNewFrame = engine->PerfCpuTimePreRender = 0;
+    if (engine->PerfCpuTimeActive && !ImTimeGetThreadCpuTimeInMicroseconds(&engine->PerfCpuTimePreNewFrame))
+        engine->PerfCpuTimePreNewFrame = 0;
+
+    // Hardware performance counters. Need to be opened and read from main thread, as they only count calling thread.
+    if (engine->PerfCountersActive)
+    {
+        if (!engine->PerfCounters.Opened)
+            engine->PerfCounters.Open();
+        ImU64 counters[ImPerfCounter_COUNT];
+        engine->PerfCounters.Read(counters);
+        for (int n = 0; n < ImPerfCounter_COUNT; n++)
+        {
+            engine->PerfCountersFrame[n] = engine->PerfCountersValid ? counters[n] - engine->PerfCountersPrev[n] : 0;
+            engine->PerfCountersPrev[n] = counters[n];
+        }
+        engine->PerfCountersValid = true;
+    }
+    else
+    {
+        engine->PerfCountersValid = false;
+    }
 
     engine->CaptureContext.PreNewFrame();
 
@@ -844,6 +1106,10 @@ static void ImGuiTestEngine_PreNewFrame(ImGuiTestEngine* engine, ImGuiContext* u
         engine->ToolDebugRebootUiContext = false;
     }
 
+    // Virtual clock: simulated time step, unless a specific time step was requested (e.g. SleepNoSkip())
+    if (engine->OverrideDeltaTime < 0.0f && ImGuiTestEngine_IsUsingVirtualTime(engine))
+        engine->OverrideDeltaTime = engine->IO.ConfigVirtualTimeStep;
+
     // Inject extra time into the Dear ImGui context
     if (engine->OverrideDeltaTime >= 0.0f)
     {
@@ -853,6 +1119,14 @@ static void ImGuiTestEngine_PreNewFrame(ImGuiTestEngine* engine, ImGuiContext* u
 
     // NewFrame() will increase this so we are +1 ahead at the time of calling this
     engine->FrameCount = g.FrameCount + 1;
+
+    // Enable/disable item graph. Current frame will be the first fully recorded one.
+    if (engine->IO.ConfigItemGraph != (engine->ItemGraph.FirstFrame != -1))
+    {
+        engine->ItemGraph.Clear();
+        if (engine->IO.ConfigItemGraph)
+            engine->ItemGraph.FirstFrame = engine->FrameCount;
+    }
     if (ImGuiTestContext* test_ctx = engine->TestContext)
     {
         double t0 = test_ctx->RunningTime;
@@ -893,6 +1167,15 @@ static void ImGuiTestEngine_PreNewFrame(ImGuiTestEngine* engine, ImGuiContext* u
         engine->Inputs.HostEscDownDuration = -1.0f;
     }
 
+    // Record inputs submitted by backend, before they get erased by simulated inputs
+    if (engine->InputRecording != nullptr)
+    {
+        engine->InputRecording->AddFrame(g.IO.DeltaTime);
+        for (int n = engine->InputRecordingQueueSkip; n < g.InputEventsQueue.Size; n++)
+            if (!g.InputEventsQueue[n].AddedByTestEngine)
+                engine->InputRecording->AddEvent(&g.InputEventsQueue[n]);
+    }
+
     ImGuiTestEngine_ApplyInputToImGuiContext(engine);
     ImGuiTestEngine_UpdateHooks(engine);
 }
@@ -909,6 +1192,9 @@ static void ImGuiTestEngine_PostNewFrame(ImGuiTestEngine* engine, ImGuiContext*
 
     engine->IO.IsCapturing = engine->CaptureContext.IsCapturing();
 
+    // Events trickled to next frame will stay in queue: don't record them twice.
+    engine->InputRecordingQueueSkip = ui_ctx->InputEventsQueue.Size;
+
     // Garbage collect unused tasks
     const int LOCATION_TASK_ELAPSE_FRAMES = 20;
     for (int task_n = 0; task_n < engine->InfoTasks.Size; task_n++)
@@ -943,7 +1229,7 @@ static void ImGuiTestEngine_PreEndFrame(ImGuiTestEngine* engine, ImGuiContext* u
 
     // Disable vsync
     engine->IO.IsRequestingMaxAppSpeed = engine->IO.ConfigNoThrottle;
-    if (engine->IO.ConfigRunSpeed == ImGuiTestRunSpeed_Fast && engine->IO.IsRunningTests)
+    if ((engine->IO.ConfigRunSpeed == ImGuiTestRunSpeed_Fast || ImGuiTestEngine_IsUsingVirtualTime(engine)) && engine->IO.IsRunningTests)
         if (engine->TestContext && (engine->TestContext->RunFlags & ImGuiTestRunFlags_GuiFuncOnly) == 0)
             engine->IO.IsRequestingMaxAppSpeed = true;
 
@@ -960,6 +1246,8 @@ static void ImGuiTestEngine_PreRender(ImGuiTestEngine* engine, ImGuiContext* ui_
 
     // Time measurements
     engine->PerfTimestampPreRender = ImTimeGetInMicroseconds();
+    if (engine->PerfCpuTimeActive && !ImTimeGetThreadCpuTimeInMicroseconds(&engine->PerfCpuTimePreRender))
+        engine->PerfCpuTimePreRender = 0;
 
     engine->CaptureContext.PreRender();
 }
@@ -1018,6 +1306,12 @@ static void ImGuiTestEngine_RunTestFunc(ImGuiTestEngine* engine)
     // Run the test coroutine. This will resume the test queue from either the last point the test called YieldFromCoroutine(),
     // or the loop in ImGuiTestEngine_TestQueueCoroutineMain that does so if no test is running.
     // If you want to breakpoint the point execution continues in the test code, breakpoint the exit condition in YieldFromCoroutine()
+#if IMGUI_TEST_ENGINE_HAS_FORK
+    // Test queue is processed by fork() children (see ImGuiTestEngine_UpdateForkedTests())
+    if (ImGuiTestEngine_IsForkBatchRunning(engine))
+        return;
+#endif
+
     const int input_queue_size_before = ui_ctx->InputEventsQueue.Size;
     engine->IO.CoroutineFuncs->RunFunc(engine->TestQueueCoroutine);
 
@@ -1064,6 +1358,22 @@ void ImGuiTestEngine_Yield(ImGuiTestEngine* engine)
     engine->IO.CoroutineFuncs->YieldFunc();
 }
 
+// Virtual time is not used while test is suspended or running GuiFunc only, as user is interacting with it.
+// Performance tests always measure wall clock time.
+bool ImGuiTestEngine_IsUsingVirtualTime(ImGuiTestEngine* engine)
+{
+    if (!engine->IO.ConfigVirtualTime || !engine->IO.IsRunningTests)
+        return false;
+    if (ImGuiTestContext* test_ctx = engine->TestContext)
+    {
+        if ((test_ctx->RunFlags & ImGuiTestRunFlags_GuiFuncOnly) || test_ctx->TestOutput->Status == ImGuiTestStatus_Suspended)
+            return false;
+        if (test_ctx->Test->Group == ImGuiTestGroup_Perfs)
+            return false;
+    }
+    return true;
+}
+
 void ImGuiTestEngine_SetDeltaTime(ImGuiTestEngine* engine, float delta_time)
 {
     IM_ASSERT(delta_time >= 0.0f);
@@ -1161,13 +1471,15 @@ bool ImGuiTestEngine_CaptureBeginVideo(ImGuiTestEngine* engine, ImGuiCaptureArgs
     // RunSpeed set to Fast      -> Switch to Cinematic, no throttle
     // RunSpeed set to Normal    -> No change
     // RunSpeed set to Cinematic -> No change
+    // With virtual time enabled, time step is already simulated: frames are selected by capture tool using ImGui::GetTime().
     engine->BackupConfigRunSpeed = engine->IO.ConfigRunSpeed;
     engine->BackupConfigNoThrottle = engine->IO.ConfigNoThrottle;
     if (engine->IO.ConfigRunSpeed == ImGuiTestRunSpeed_Fast)
     {
         engine->IO.ConfigRunSpeed = ImGuiTestRunSpeed_Cinematic;
         engine->IO.ConfigNoThrottle = true;
-        engine->IO.ConfigFixedDeltaTime = 1.0f / 60.0f;
+        if (!engine->IO.ConfigVirtualTime)
+            engine->IO.ConfigFixedDeltaTime = 1.0f / 60.0f;
     }
     engine->CaptureCurrentArgs = args;
     engine->CaptureContext.BeginVideoCapture(args);
@@ -1211,8 +1523,26 @@ static void ImGuiTestEngine_ProcessTestQueue(ImGuiTestEngine* engine)
         if (track_scrolling)
             engine->UiSelectAndScrollToTest = run_task->Test;
 
-        // Run test
-        ImGuiTestEngine_RunTest(engine, nullptr, run_task->Test, run_task->RunFlags);
+        // Run test. When sweeping stress amount, perf tests are run once per step and PerfCapture() fits results on last step.
+        if (engine->IO.PerfStressSweepSteps >= 2 && run_task->Test->Group == ImGuiTestGroup_Perfs)
+        {
+            // Stop doubling stress amount before it overflows
+            engine->PerfSweepStepsCount = 1;
+            for (ImS64 stress_amount = ImMax(engine->IO.PerfStressAmount, 1); stress_amount * 2 <= INT_MAX && engine->PerfSweepStepsCount < engine->IO.PerfStressSweepSteps; stress_amount *= 2)
+                engine->PerfSweepStepsCount++;
+            engine->PerfSweepPoints.resize(0);
+            for (engine->PerfSweepStep = 0; engine->PerfSweepStep < engine->PerfSweepStepsCount; engine->PerfSweepStep++)
+            {
+                ImGuiTestEngine_RunTest(engine, nullptr, run_task->Test, run_task->RunFlags);
+                if (run_task->Test->Output.Status != ImGuiTestStatus_Success || engine->Abort)
+                    break;
+            }
+            engine->PerfSweepStep = engine->PerfSweepStepsCount = -1;
+        }
+        else
+        {
+            ImGuiTestEngine_RunTest(engine, nullptr, run_task->Test, run_task->RunFlags);
+        }
 
         // Cleanup
         IM_ASSERT(engine->TestContext == nullptr);
@@ -1233,12 +1563,351 @@ static void ImGuiTestEngine_ProcessTestQueue(ImGuiTestEngine* engine)
     engine->TestsQueue.clear();
 
     // Restore UI state (done after all ImGuiTestEngine_RunTest() are done)
+    if (engine->UiStateSnapshot.Valid)
+    {
+        engine->UiStateSnapshot.Restore(*engine->UiContextTarget);
+        engine->UiStateSnapshot.Clear();
+    }
     if (ran_tests && engine->IO.ConfigRestoreFocusAfterTests)
         ImGui::FocusWindow(backup_nav_window);
+
+#if IMGUI_TEST_ENGINE_HAS_FORK
+    // Fork isolation: child process is done with its test
+    if (engine->ForkChildPipe != -1)
+        ImGuiTestEngine_ForkChildSendOutputAndExit(engine);
+#endif
 }
 
+#if IMGUI_TEST_ENGINE_HAS_FORK
+// Output of a test which ran in a fork() child, sent to parent process over a pipe.
+// Followed by ActionStats[], log text and log LineInfo[]. ActionStats point to literals, which have same addresses in both processes.
+struct ImGuiTestForkOutputHeader
+{
+    ImGuiTestStatus Status;
+    ImU64           StartTime;
+    ImU64           EndTime;
+    int             ActionCount;
+    int             ActionFrames;
+    int             EngineAllocCount;
+    int             ActionStatsCount;
+    int             LogTextLen;
+    int             LogLineCount;
+};
+
+static bool ImGuiTestEngine_ForkWrite(int fd, const void* data, size_t size)
+{
+    const char* p = (const char*)data;
+    while (size > 0)
+    {
+        ssize_t written = write(fd, p, size);
+        if (written < 0 && errno == EINTR)
+            continue;
+        if (written <= 0)
+            return false;
+        p += written;
+        size -= (size_t)written;
+    }
+    return true;
+}
+
+static void ImGuiTestEngine_ForkChildSendOutputAndExit(ImGuiTestEngine* engine)
+{
+    ImGuiTestOutput* output = &engine->ForkChildTest->Output;
+    ImGuiTestForkOutputHeader header;
+    header.Status = output->Status;
+    header.StartTime = output->StartTime;
+    header.EndTime = output->EndTime;
+    header.ActionCount = output->ActionCount;
+    header.ActionFrames = output->ActionFrames;
+    header.EngineAllocCount = output->EngineAllocCount;
+    header.ActionStatsCount = output->ActionStats.Size;
+    header.LogTextLen = output->Log.GetTextLen();
+    header.LogLineCount = output->Log.LineInfo.Size;
+
+    const int fd = engine->ForkChildPipe;
+    bool ret = ImGuiTestEngine_ForkWrite(fd, &header, sizeof(header));
+    ret = ret && ImGuiTestEngine_ForkWrite(fd, output->ActionStats.Data, (size_t)output->ActionStats.size_in_bytes());
+    ret = ret && ImGuiTestEngine_ForkWrite(fd, output->Log.GetText(), (size_t)header.LogTextLen);
+    ret = ret && ImGuiTestEngine_ForkWrite(fd, output->Log.LineInfo.Data, (size_t)output->Log.LineInfo.size_in_bytes());
+    close(fd);
+
+    // Skip atexit handlers and destructors: parent owns settings, exports and other resources.
+    fflush(stdout);
+    fflush(stderr);
+    _exit(ret ? 0 : 1);
+}
+
+static bool ImGuiTestEngine_ForkReadOutput(ImGuiTestEngine* engine, ImGuiTest* test, const ImVector<char>& data)
+{
+    ImGuiTestForkOutputHeader header;
+    if (data.Size < (int)sizeof(header))
+        return false;
+    memcpy(&header, data.Data, sizeof(header));
+    const size_t action_stats_size = (size_t)header.ActionStatsCount * sizeof(ImGuiTestActionStats);
+    const size_t log_lines_size = (size_t)header.LogLineCount * sizeof(ImGuiTestLogLineInfo);
+    if ((size_t)data.Size != sizeof(header) + action_stats_size + (size_t)header.LogTextLen + log_lines_size)
+        return false;
+
+    ImGuiTestOutput* output = &test->Output;
+    const char* p = data.Data + sizeof(header);
+    output->Status = header.Status;
+    output->StartTime = header.StartTime;
+    output->EndTime = header.EndTime;
+    output->ActionCount = header.ActionCount;
+    output->ActionFrames = header.ActionFrames;
+    output->EngineAllocCount = header.EngineAllocCount;
+    output->ActionStats.resize(header.ActionStatsCount);
+    if (action_stats_size > 0)
+        memcpy(output->ActionStats.Data, p, action_stats_size);
+    p += action_stats_size;
+
+    // Rebuild log one line at a time to restore per-level line counts
+    const char* log_text = p;
+    p += header.LogTextLen;
+    output->Log.Clear();
+    for (int n = 0; n < header.LogLineCount; n++)
+    {
+        ImGuiTestLogLineInfo line_info;
+        memcpy(&line_info, p + n * sizeof(line_info), sizeof(line_info));
+        if (line_info.LineOffset < 0 || line_info.LineLength < 0 || line_info.LineOffset + line_info.LineLength > header.LogTextLen)
+            break;
+        const int start_offset = output->Log.Buffer.size();
+        output->Log.Buffer.append(log_text + line_info.LineOffset, log_text + line_info.LineOffset + line_info.LineLength);
+        output->Log.Buffer.append("\n");
+        output->Log.UpdateLineOffsets(&engine->IO, line_info.Level, output->Log.Buffer.begin() + start_offset);
+    }
+    return true;
+}
+
+static bool ImGuiTestEngine_IsForkBatchRunning(ImGuiTestEngine* engine)
+{
+    return engine->ForkTasks.Size > 0 || engine->ForkRunningPid != -1;
+}
+
+static void ImGuiTestEngine_ForkKillRunningChild(ImGuiTestEngine* engine)
+{
+    if (engine->ForkRunningPid == -1)
+        return;
+    kill((pid_t)engine->ForkRunningPid, SIGKILL);
+    close(engine->ForkRunningPipe);
+    int wait_status = 0;
+    while (waitpid((pid_t)engine->ForkRunningPid, &wait_status, 0) < 0 && errno == EINTR) {}
+    engine->ForkRunningPid = engine->ForkRunningPipe = -1;
+    engine->ForkRunningOutput.clear();
+}
+
+// Time after which a child which didn't send its output is killed.
+// Child's own watchdog fails a test which keeps yielding for too long: this only catches children which stopped responding.
+static float ImGuiTestEngine_ForkGetKillTimeout(ImGuiTestEngine* engine)
+{
+    const float watchdog_kill_test = (engine->IO.ConfigRunSpeed == ImGuiTestRunSpeed_Fast) ? engine->IO.ConfigWatchdogKillTest : engine->IO.ConfigWatchdogKillTest * 10.0f;
+    return watchdog_kill_test + 5.0f;
+}
+
+// Read available output of running child without blocking. Return true when child is done (pipe closed or child killed).
+static bool ImGuiTestEngine_ForkPollRunningChild(ImGuiTestEngine* engine)
+{
+    while (true)
+    {
+        struct pollfd pfd = { engine->ForkRunningPipe, POLLIN, 0 };
+        const int ret = poll(&pfd, 1, 0);
+        if (ret < 0 && errno == EINTR)
+            continue;
+        if (ret < 0)
+            return true;
+        if (ret == 0)
+            break;
+        char buf[4096];
+        const ssize_t len = read(engine->ForkRunningPipe, buf, sizeof(buf));
+        if (len < 0 && errno == EINTR)
+            continue;
+        if (len <= 0)
+            return true; // Child exited or crashed
+        ImVector<char>& data = engine->ForkRunningOutput;
+        data.resize(data.Size + (int)len);
+        memcpy(data.Data + data.Size - len, buf, (size_t)len);
+    }
+
+    if ((double)(ImTimeGetInMicroseconds() - engine->ForkRunningStartTime) / 1000000.0 > ImGuiTestEngine_ForkGetKillTimeout(engine))
+    {
+        kill((pid_t)engine->ForkRunningPid, SIGKILL);
+        engine->ForkRunningKilled = true;
+        return true;
+    }
+    return false;
+}
+
+// Reap running child and store its output into test
+static void ImGuiTestEngine_ForkFinishRunningChild(ImGuiTestEngine* engine, ImGuiTest* test)
+{
+    close(engine->ForkRunningPipe);
+    int wait_status = 0;
+    while (waitpid((pid_t)engine->ForkRunningPid, &wait_status, 0) < 0 && errno == EINTR) {}
+    engine->ForkRunningPid = engine->ForkRunningPipe = -1;
+
+    if (!ImGuiTestEngine_ForkReadOutput(engine, test, engine->ForkRunningOutput))
+    {
+        ImGuiTestOutput* output = &test->Output;
+        output->Status = ImGuiTestStatus_Error;
+        output->StartTime = engine->ForkRunningStartTime;
+        output->EndTime = ImTimeGetInMicroseconds();
+        Str256 msg;
+        if (engine->ForkRunningKilled)
+            msg.setf("[Fork] Test process killed after %.f seconds.", ImGuiTestEngine_ForkGetKillTimeout(engine));
+        else if (WIFSIGNALED(wait_status))
+            msg.setf("[Fork] Test process crashed with signal %d (%s).", WTERMSIG(wait_status), strsignal(WTERMSIG(wait_status)));
+        else
+            msg.setf("[Fork] Test process exited with code %d without sending results.", WIFEXITED(wait_status) ? WEXITSTATUS(wait_status) : -1);
+        if (engine->IO.ConfigLogToTTY)
+            fprintf(stderr, "%s: %s\n", test->Name, msg.c_str());
+        output->Log.Clear();
+        output->Log.Buffer.appendf("%s\n", msg.c_str());
+        output->Log.UpdateLineOffsets(&engine->IO, ImGuiTestVerboseLevel_Error, output->Log.Buffer.begin());
+    }
+    engine->ForkRunningOutput.clear();
+    if (test->Output.Status == ImGuiTestStatus_Error && engine->IO.ConfigStopOnError)
+        engine->Abort = true;
+}
+
+// Run queued tests, each in a fork() of current process: it starts from the same warmed-up state, a crash or a hang only fails
+// the test and state changes don't leak into following tests. Perf tests are left for the test queue coroutine to run in-process.
+// Called every frame while a batch is running: at most one child runs at a time and the parent never blocks waiting for it,
+// so its frame loop keeps running. In a child, return with a single test queued and engine->ForkChildPipe set: child exits
+// at the end of ImGuiTestEngine_ProcessTestQueue().
+// Children run the app frame loop: this requires a headless app (no platform backend, e.g. imgui_app's Null backend), as a
+// window, GPU context or display server connection can't be shared with the parent. At the time of fork() the only other thread
+// is the test queue coroutine's, which is parked: children start a new coroutine and abandon the previous handle, whose thread
+// doesn't exist in the child (children end with _exit() and never destroy it).
+static void ImGuiTestEngine_UpdateForkedTests(ImGuiTestEngine* engine)
+{
+    // Start a batch: take tests from queue
+    if (!ImGuiTestEngine_IsForkBatchRunning(engine))
+    {
+        if (engine->UiContextTarget->IO.BackendPlatformName != nullptr)
+        {
+            IM_ASSERT(0 && "ConfigForkIsolation requires a headless application without platform backend! Running tests in-process.");
+            engine->IO.ConfigForkIsolation = false;
+            return;
+        }
+        engine->ForkTasks.resize(0);
+        engine->ForkTasksInProcess.resize(0);
+        for (ImGuiTestRunTask& run_task : engine->TestsQueue)
+            if (run_task.Test->Group == ImGuiTestGroup_Perfs)
+                engine->ForkTasksInProcess.push_back(run_task);
+            else
+                engine->ForkTasks.push_back(run_task);
+        if (engine->ForkTasks.Size == 0)
+        {
+            engine->ForkTasksInProcess.resize(0);
+            return;
+        }
+        engine->TestsQueue.resize(0);
+        engine->BatchStartTime = ImTimeGetInMicroseconds();
+        engine->IO.IsRunningTests = true;
+    }
+
+    // Running child: collect output, reap once done
+    if (engine->ForkRunningPid != -1)
+    {
+        ImGuiTest* test = engine->ForkTasks[0].Test;
+        if (engine->Abort)
+        {
+            ImGuiTestEngine_ForkKillRunningChild(engine);
+            test->Output.Status = ImGuiTestStatus_Unknown;
+        }
+        else if (ImGuiTestEngine_ForkPollRunningChild(engine))
+        {
+            ImGuiTestEngine_ForkFinishRunningChild(engine, test);
+        }
+        else
+        {
+            return;
+        }
+        engine->ForkTasks.erase(engine->ForkTasks.Data);
+    }
+
+    // Start next child
+    while (engine->ForkTasks.Size > 0)
+    {
+        ImGuiTestRunTask run_task = engine->ForkTasks[0];
+        ImGuiTest* test = run_task.Test;
+        if (engine->Abort)
+        {
+            test->Output.Status = ImGuiTestStatus_Unknown;
+            engine->ForkTasks.erase(engine->ForkTasks.Data);
+            continue;
+        }
+
+        int fds[2];
+        if (pipe(fds) != 0)
+        {
+            engine->ForkTasksInProcess.push_back(run_task);
+            engine->ForkTasks.erase(engine->ForkTasks.Data);
+            continue;
+        }
+        fflush(stdout);
+        fflush(stderr);
+        const pid_t pid = fork();
+        if (pid == 0)
+        {
+            // Child: run this test only
+            close(fds[0]);
+            engine->ForkChildPipe = fds[1];
+            engine->ForkChildTest = test;
+            engine->ForkTasks.resize(0);
+            engine->ForkTasksInProcess.resize(0);
+            engine->TestsQueue.resize(0);
+            engine->TestsQueue.push_back(run_task);
+            engine->IO.IsRunningTests = false;
+            engine->IO.ExportResultsFormat = ImGuiTestEngineExportFormat_None;  // Parent exports results
+            engine->UiContextTarget->IO.IniFilename = nullptr;                  // Parent saves settings
+            engine->TestQueueCoroutine = engine->IO.CoroutineFuncs->CreateFunc(ImGuiTestEngine_TestQueueCoroutineMain, "Main Dear ImGui Test Thread", engine);
+            const int crash_signals[] = { SIGILL, SIGABRT, SIGFPE, SIGSEGV, SIGBUS };
+            for (int crash_signal : crash_signals)
+                signal(crash_signal, SIG_DFL);                                  // Parent reports crashes
+            return;
+        }
+        close(fds[1]);
+        if (pid < 0)
+        {
+            close(fds[0]);
+            engine->ForkTasksInProcess.push_back(run_task);
+            engine->ForkTasks.erase(engine->ForkTasks.Data);
+            continue;
+        }
+
+        // Parent: output is collected on following frames
+        test->Output.Status = ImGuiTestStatus_Running;
+        engine->UiSelectedTest = test;
+        engine->ForkRunningPid = (int)pid;
+        engine->ForkRunningPipe = fds[0];
+        engine->ForkRunningStartTime = ImTimeGetInMicroseconds();
+        engine->ForkRunningKilled = false;
+        engine->ForkRunningOutput.resize(0);
+        return;
+    }
+
+    // End of batch: remaining tests are processed by coroutine as usual
+    engine->BatchEndTime = ImTimeGetInMicroseconds();
+    engine->IO.IsRunningTests = false;
+    if (engine->Abort)
+    {
+        for (ImGuiTestRunTask& run_task : engine->ForkTasksInProcess)
+            run_task.Test->Output.Status = ImGuiTestStatus_Unknown;
+        engine->ForkTasksInProcess.resize(0);
+        engine->Abort = false;
+    }
+    engine->TestsQueue.swap(engine->ForkTasksInProcess);
+    engine->ForkTasksInProcess.resize(0);
+}
+#endif // #if IMGUI_TEST_ENGINE_HAS_FORK
+
 bool ImGuiTestEngine_IsTestQueueEmpty(ImGuiTestEngine* engine)
 {
+#if IMGUI_TEST_ENGINE_HAS_FORK
+    if (ImGuiTestEngine_IsForkBatchRunning(engine) || engine->ForkTasksInProcess.Size > 0)
+        return false;
+#endif
     return engine->TestsQueue.Size == 0;
 }
 
@@ -1247,6 +1916,12 @@ static bool ImGuiTestEngine_IsRunningTest(ImGuiTestEngine* engine, ImGuiTest* te
     for (ImGuiTestRunTask& t : engine->TestsQueue)
         if (t.Test == test)
             return true;
+    for (ImGuiTestRunTask& t : engine->ForkTasks)
+        if (t.Test == test)
+            return true;
+    for (ImGuiTestRunTask& t : engine->ForkTasksInProcess)
+        if (t.Test == test)
+            return true;
     return false;
 }
 
@@ -1315,6 +1990,8 @@ void ImGuiTestEngine_UnregisterTest(ImGuiTestEngine* engine, ImGuiTest* test)
         engine->UiSelectAndScrollToTest = nullptr;
     if (engine->UiSelectedTest == test)
         engine->UiSelectedTest = nullptr;
+    engine->UiLogSearchResults.clear();
+    engine->UiLogSearchLineCount = -1;
     engine->TestsSourceLinesDirty = true;
 
     IM_DELETE(test);
@@ -1329,6 +2006,8 @@ void ImGuiTestEngine_UnregisterAllTests(ImGuiTestEngine* engine)
     engine->TestsQueue.clear();
     engine->UiSelectAndScrollToTest = nullptr;
     engine->UiSelectedTest = nullptr;
+    engine->UiLogSearchResults.clear();
+    engine->UiLogSearchLineCount = -1;
     engine->TestsSourceLinesDirty = true;
 }
 
@@ -1498,12 +2177,32 @@ void ImGuiTestEngine_UpdateTestsSourceLines(ImGuiTestEngine* engine)
         }
 }
 
+// Search all test logs (see ImGuiTestLog::Search()). Results are ordered by test registration order, then line order.
+int ImGuiTestEngine_SearchLogs(ImGuiTestEngine* engine, const char* query, ImVector<ImGuiTestLogSearchResult>* out_results)
+{
+    const int count_before = out_results->Size;
+    ImVector<int> lines;
+    for (ImGuiTest* test : engine->TestsAll)
+    {
+        lines.resize(0);
+        if (test->Output.Log.Search(query, &lines) == 0)
+            continue;
+        for (int line_idx : lines)
+            out_results->push_back({ test, line_idx });
+    }
+    return out_results->Size - count_before;
+}
+
 // count_remaining could be >0 if e.g. called during a crash handler or aborting a run.
 void ImGuiTestEngine_GetResultSummary(ImGuiTestEngine* engine, ImGuiTestEngineResultSummary* out_results)
 {
     int count_tested = 0;
     int count_success = 0;
     int count_remaining = 0;
+    int action_count = 0;
+    int action_frames = 0;
+    int engine_alloc_count = 0;
+    int engine_alloc_count_tests = 0;
     for (int n = 0; n < engine->TestsAll.Size; n++)
     {
         ImGuiTest* test = engine->TestsAll[n];
@@ -1518,10 +2217,21 @@ void ImGuiTestEngine_GetResultSummary(ImGuiTestEngine* engine, ImGuiTestEngineRe
         count_tested++;
         if (test->Output.Status == ImGuiTestStatus_Success)
             count_success++;
+        action_count += test->Output.ActionCount;
+        action_frames += test->Output.ActionFrames;
+        if (test->Output.EngineAllocCount >= 0)
+        {
+            engine_alloc_count += test->Output.EngineAllocCount;
+            engine_alloc_count_tests++;
+        }
     }
     out_results->CountTested = count_tested;
     out_results->CountSuccess = count_success;
     out_results->CountInQueue = count_remaining;
+    out_results->ActionCount = action_count;
+    out_results->ActionFrames = action_frames;
+    out_results->EngineAllocCount = engine_alloc_count;
+    out_results->EngineAllocCountTests = engine_alloc_count_tests;
 }
 
 // Get a copy of the test list
@@ -1549,7 +2259,9 @@ static void ImGuiTestEngine_UpdateHooks(ImGuiTestEngine* engine)
         want_hooking = true;
     if (engine->FindByLabelTask.InSuffix != nullptr)
         want_hooking = true;
-    if (engine->GatherTask.InParentID != 0)
+    if (engine->GatherTasks.Size > 0)
+        want_hooking = true;
+    if (engine->ItemGraph.FirstFrame != -1)
         want_hooking = true;
 
     // Update test engine specific hooks
@@ -1629,10 +2341,175 @@ struct ImGuiTestContextUiContextBackup
     }
 };
 
+void ImGuiTestUiStateSnapshot::Capture(ImGuiContext& g)
+{
+    Clear();
+    for (ImGuiWindow* window : g.Windows)
+    {
+        WindowState state;
+        state.ID = window->ID;
+        state.Pos = window->Pos;
+        state.SizeFull = window->SizeFull;
+        state.Scroll = window->Scroll;
+        state.Collapsed = window->Collapsed;
+#ifdef IMGUI_HAS_DOCK
+        state.DockId = window->DockId;
+#else
+        state.DockId = 0;
+#endif
+        Windows.push_back(state);
+    }
+    SettingsWindows = g.SettingsWindows;
+    SettingsTables = g.SettingsTables;
+#ifdef IMGUI_HAS_DOCK
+    for (int n = 0; n < g.DockContext.Nodes.Data.Size; n++)
+        if (ImGuiDockNode* node = (ImGuiDockNode*)g.DockContext.Nodes.Data[n].val_p)
+            DockNodes.push_back(node->ID);
+#endif
+    Valid = true;
+}
+
+// Windows created after the snapshot are left alone (they will generally get hidden when not submitted anymore).
+// We don't restore z-order and focus: see ImGuiTestEngineIO::ConfigRestoreFocusAfterTests.
+void ImGuiTestUiStateSnapshot::Restore(ImGuiContext& g)
+{
+    IM_ASSERT(Valid);
+
+    // Settings: windows and tables created from now on will use them. Offsets into previous buffers are invalidated.
+    g.SettingsWindows = SettingsWindows;
+    g.SettingsTables = SettingsTables;
+    for (ImGuiWindow* window : g.Windows)
+        window->SettingsOffset = -1;
+
+    // Tables reload their settings on next BeginTable(), or revert to their defaults if they had none.
+    for (int n = 0; n < g.Tables.GetMapSize(); n++)
+        if (ImGuiTable* table = g.Tables.TryGetMapData(n))
+        {
+            table->SettingsOffset = -1;
+            if (ImGui::TableSettingsFindByID(table->ID) != nullptr)
+                table->IsSettingsRequestLoad = true;
+            else
+                ImGui::TableResetSettings(table);
+        }
+
+#ifdef IMGUI_HAS_DOCK
+    // Remove root dock nodes created after the snapshot (this undocks their windows), then dock windows back into their node.
+    // FIXME-TESTS: Nodes split from a node which existed at the time of the snapshot are left in place.
+    ImVector<ImGuiID> new_root_nodes;
+    for (int n = 0; n < g.DockContext.Nodes.Data.Size; n++)
+        if (ImGuiDockNode* node = (ImGuiDockNode*)g.DockContext.Nodes.Data[n].val_p)
+            if (node->IsRootNode() && !DockNodes.contains(node->ID))
+                new_root_nodes.push_back(node->ID);
+    for (ImGuiID node_id : new_root_nodes)
+        ImGui::DockBuilderRemoveNode(node_id);
+    for (const WindowState& state : Windows)
+        if (ImGuiWindow* window = ImGui::FindWindowByID(state.ID))
+            if (window->DockId != state.DockId && (state.DockId == 0 || ImGui::DockBuilderGetNode(state.DockId) != nullptr))
+                ImGui::DockBuilderDockWindow(window->Name, state.DockId);
+#endif
+
+    // Windows
+    for (const WindowState& state : Windows)
+    {
+        ImGuiWindow* window = ImGui::FindWindowByID(state.ID);
+        if (window == nullptr)
+            continue;
+        window->Scroll = state.Scroll;
+        window->ScrollTarget = ImVec2(FLT_MAX, FLT_MAX);
+        if ((window->Flags & ImGuiWindowFlags_ChildWindow) || state.DockId != 0)
+            continue;
+        ImGui::SetWindowPos(window, state.Pos, ImGuiCond_Always);
+        ImGui::SetWindowSize(window, state.SizeFull, ImGuiCond_Always);
+        ImGui::SetWindowCollapsed(window, state.Collapsed, ImGuiCond_Always);
+    }
+}
+
+// Number of allocator calls so far, or -1 if unavailable.
+int ImGuiTestEngine_GetAllocCount(ImGuiContext* ui_ctx)
+{
+#if IMGUI_VERSION_NUM >= 18993
+    return ui_ctx->DebugAllocInfo.TotalAllocCount;
+#else
+    IM_UNUSED(ui_ctx);
+    return -1;
+#endif
+}
+
+// Per-test allocations are reused across test runs:
+// - Test contexts are pooled per nesting level and reset to their default state, keeping capacity of their buffers.
+// - UserVars are allocated from an arena, used as a stack. Only grown when empty (so parent vars don't move), otherwise fallback to heap.
+// - Test logs keep their capacity when cleared. Before the first run of a test, its log is reserved to the average size of logs so far.
+// - Gather tasks are recycled. Capture args live on the stack and only allocate when a test takes a capture.
+struct ImGuiTestContextPoolScope
+{
+    ImGuiTestEngine*    Engine;
+    ImGuiTestContext*   Context = nullptr;
+
+    ImGuiTestContextPoolScope(ImGuiTestEngine* engine, bool acquire)
+    {
+        Engine = engine;
+        if (!acquire)
+            return;
+        if (engine->TestContextPoolUsed == engine->TestContextPool.Size)
+            engine->TestContextPool.push_back(IM_NEW(ImGuiTestContext)());
+        Context = engine->TestContextPool[engine->TestContextPoolUsed++];
+
+        // Reset to default state, keeping buffers
+        ImVector<char> temp_string, clipboard;
+        ImVector<ImGuiWindow*> foreign_windows;
+        temp_string.swap(Context->TempString);
+        clipboard.swap(Context->Clipboard);
+        foreign_windows.swap(Context->ForeignWindowsToHide);
+        *Context = ImGuiTestContext();
+        Context->TempString.swap(temp_string);
+        Context->Clipboard.swap(clipboard);
+        Context->ForeignWindowsToHide.swap(foreign_windows);
+        Context->TempString.resize(0);
+        Context->Clipboard.resize(0);
+        Context->ForeignWindowsToHide.resize(0);
+    }
+    ~ImGuiTestContextPoolScope()
+    {
+        if (Context == nullptr)
+            return;
+        IM_ASSERT(Engine->TestContextPoolUsed > 0 && Engine->TestContextPool[Engine->TestContextPoolUsed - 1] == Context);
+        Engine->TestContextPoolUsed--;
+    }
+};
+
+static void* ImGuiTestEngine_UserVarsAlloc(ImGuiTestEngine* engine, size_t size)
+{
+    const int aligned_size = (int)IM_MEMALIGN(size, 16);
+    if (engine->UserVarsArenaUsed + aligned_size > engine->UserVarsArena.Capacity)
+    {
+        if (engine->UserVarsArenaUsed != 0)
+            return IM_ALLOC(size);
+        engine->UserVarsArena.reserve(ImMax(aligned_size, engine->UserVarsArena.Capacity * 2));
+    }
+    void* ptr = engine->UserVarsArena.Data + engine->UserVarsArenaUsed;
+    engine->UserVarsArenaUsed += aligned_size;
+    return ptr;
+}
+
+static void ImGuiTestEngine_UserVarsFree(ImGuiTestEngine* engine, void* ptr, size_t size)
+{
+    char* p = (char*)ptr;
+    char* arena_begin = engine->UserVarsArena.Data;
+    if (arena_begin == nullptr || p < arena_begin || p >= arena_begin + engine->UserVarsArena.Capacity)
+    {
+        IM_FREE(ptr);
+        return;
+    }
+    const int aligned_size = (int)IM_MEMALIGN(size, 16);
+    IM_ASSERT(p + aligned_size == arena_begin + engine->UserVarsArenaUsed && "UserVars must be freed in reverse order of allocation.");
+    engine->UserVarsArenaUsed -= aligned_size;
+}
+
 // FIXME: Work toward simplifying this function?
 void ImGuiTestEngine_RunTest(ImGuiTestEngine* engine, ImGuiTestContext* parent_ctx, ImGuiTest* test, ImGuiTestRunFlags run_flags)
 {
-    ImGuiTestContext stack_ctx;
+    const int alloc_count_setup_start = ImGuiTestEngine_GetAllocCount(engine->UiContextTarget);
+    ImGuiTestContextPoolScope pooled_ctx(engine, (run_flags & ImGuiTestRunFlags_ShareTestContext) == 0);
     ImGuiCaptureArgs stack_capture_args;
     ImGuiTestContext* ctx;
 
@@ -1645,13 +2522,13 @@ void ImGuiTestEngine_RunTest(ImGuiTestEngine* engine, ImGuiTestContext* parent_c
     else
     {
         // Create a test context
-        ctx = &stack_ctx;
+        ctx = pooled_ctx.Context;
         ctx->Engine = engine;
         ctx->EngineIO = &engine->IO;
         ctx->Inputs = &engine->Inputs;
         ctx->CaptureArgs = &stack_capture_args;
         ctx->UserVars = nullptr;
-        ctx->PerfStressAmount = engine->IO.PerfStressAmount;
+        ctx->PerfStressAmount = engine->IO.PerfStressAmount << ImMax(engine->PerfSweepStep, 0);
 #ifdef IMGUI_HAS_DOCK
         ctx->HasDock = true;
 #else
@@ -1665,6 +2542,10 @@ void ImGuiTestEngine_RunTest(ImGuiTestEngine* engine, ImGuiTestContext* parent_c
         ctx->Test = test;
         test_output = ctx->TestOutput = &test->Output;
         test_output->StartTime = ImTimeGetInMicroseconds();
+        test_output->ActionCount = test_output->ActionFrames = 0;
+        test_output->ActionStats.resize(0);
+        test_output->ActionStatsLookup.Data.resize(0);
+        test_output->EngineAllocCount = -1;
     }
     else
     {
@@ -1719,7 +2600,7 @@ void ImGuiTestEngine_RunTest(ImGuiTestEngine* engine, ImGuiTestContext* parent_c
         ctx->GenericVars.Clear();
         if (test->VarsConstructor != nullptr)
         {
-            ctx->UserVars = IM_ALLOC(test->VarsSize);
+            ctx->UserVars = ImGuiTestEngine_UserVarsAlloc(engine, test->VarsSize);
             memset(ctx->UserVars, 0, test->VarsSize);
             test->VarsConstructor(ctx->UserVars);
             if (test->VarsPostConstructor != nullptr && test->VarsPostConstructorUserFn != nullptr)
@@ -1730,8 +2611,16 @@ void ImGuiTestEngine_RunTest(ImGuiTestEngine* engine, ImGuiTestContext* parent_c
     // Log header
     if (parent_ctx == nullptr)
     {
+        if (engine->LogSizeTestsCount > 0 && test_output->Log.Buffer.Buf.Capacity == 0)
+        {
+            const int reserve_lines = engine->LogLinesTotal / engine->LogSizeTestsCount;
+            test_output->Log.Buffer.reserve((int)(engine->LogSizeTotal / engine->LogSizeTestsCount) + 1);
+            test_output->Log.LineInfo.reserve(reserve_lines);
+            test_output->Log.LineBlocks.reserve(reserve_lines / IMGUI_TEST_LOG_LINES_PER_BLOCK + 1);
+        }
         ctx->LogEx(ImGuiTestVerboseLevel_Info, ImGuiTestLogFlags_NoHeader, "----------------------------------------------------------------------"); // Intentionally TTY only (just before clear: make it a flag?)
-        test_output->Log.Clear();
+        if (engine->PerfSweepStep <= 0) // Keep log of all steps when sweeping stress amount
+            test_output->Log.Clear();
         ctx->LogWarning("Test: '%s' '%s'..", test->Category, test->Name);
     }
     else
@@ -1743,6 +2632,16 @@ void ImGuiTestEngine_RunTest(ImGuiTestEngine* engine, ImGuiTestContext* parent_c
     // Clear ImGui inputs to avoid key/mouse leaks from one test to another
     ImGuiTestEngine_ClearInput(engine);
 
+    // Restore windows, settings, tables and docking state captured by first test of the batch run with IO.ConfigRestoreUiStateBetweenTests set
+    if (parent_ctx == nullptr && engine->UiStateSnapshot.Valid)
+        engine->UiStateSnapshot.Restore(*ctx->UiContext);
+    else if (parent_ctx == nullptr && engine->IO.ConfigRestoreUiStateBetweenTests)
+        engine->UiStateSnapshot.Capture(*ctx->UiContext);
+
+    // Forget items from previous tests
+    if (parent_ctx == nullptr && engine->ItemGraph.FirstFrame != -1)
+        ImGuiTestEngine_ItemGraphGarbageCollect(engine);
+
     // Backup entire IO and style. Allows tests modifying them and not caring about restoring state.
     ImGuiTestContextUiContextBackup backup_ui_context;
     backup_ui_context.Backup(*ctx->UiContext);
@@ -1811,7 +2710,12 @@ void ImGuiTestEngine_RunTest(ImGuiTestEngine* engine, ImGuiTestContext* parent_c
     ctx->SetRef("");
     ctx->SetInputMode(ImGuiInputSource_Mouse);
     ctx->UiContext->NavInputSource = ImGuiInputSource_Keyboard;
-    ctx->Clipboard.clear();
+    ctx->Clipboard.resize(0);
+
+    int alloc_count_setup = -1;
+    if (alloc_count_setup_start != -1)
+        alloc_count_setup = ImGuiTestEngine_GetAllocCount(ctx->UiContext) - alloc_count_setup_start;
+    const int log_alloc_count_test_start = engine->LogAllocCount;
 
     // Warm up GUI
     // - We need one mandatory frame running GuiFunc before running TestFunc
@@ -1938,6 +2842,8 @@ void ImGuiTestEngine_RunTest(ImGuiTestEngine* engine, ImGuiTestContext* parent_c
         test_output->Status = ImGuiTestStatus_Unknown;
 
     // Log result
+    if (parent_ctx == nullptr && test_output->ActionCount > 0)
+        ctx->LogDebug("%d actions in %d frames (%.2f frames/action)", test_output->ActionCount, test_output->ActionFrames, (double)test_output->ActionFrames / test_output->ActionCount);
     if (test_output->Status == ImGuiTestStatus_Success)
     {
         if ((ctx->RunFlags & ImGuiTestRunFlags_NoSuccessMsg) == 0)
@@ -1953,6 +2859,8 @@ void ImGuiTestEngine_RunTest(ImGuiTestEngine* engine, ImGuiTestContext* parent_c
     // Additional yields to avoid consecutive tests who may share identifiers from missing their window/item activation.
     ctx->RunFlags |= ImGuiTestRunFlags_GuiFuncDisable;
     ctx->Yield(3);
+    const int alloc_count_teardown_start = ImGuiTestEngine_GetAllocCount(ctx->UiContext);
+    const int log_alloc_count_test = engine->LogAllocCount - log_alloc_count_test_start; // Setup/teardown already include their own log allocations
 
     // Restore active func
     ctx->ActiveFunc = backup_active_func;
@@ -1977,7 +2885,7 @@ void ImGuiTestEngine_RunTest(ImGuiTestEngine* engine, ImGuiTestContext* parent_c
         {
             test->VarsDestructor(ctx->UserVars);
             if (ctx->UserVars)
-                IM_FREE(ctx->UserVars);
+                ImGuiTestEngine_UserVarsFree(engine, ctx->UserVars, test->VarsSize);
             ctx->UserVars = nullptr;
         }
         if (run_flags & ImGuiTestRunFlags_ShareTestContext)
@@ -1987,7 +2895,16 @@ void ImGuiTestEngine_RunTest(ImGuiTestEngine* engine, ImGuiTestContext* parent_c
         }
     }
 
-    // 'ctx' at this point is either a local variable or shared with parent.
+    // Allocator calls made by engine itself (setup, teardown and test log, excluding GuiFunc/TestFunc and frames)
+    if (parent_ctx == nullptr)
+    {
+        test_output->EngineAllocCount = (alloc_count_setup != -1) ? alloc_count_setup + ImGuiTestEngine_GetAllocCount(ctx->UiContext) - alloc_count_teardown_start + log_alloc_count_test : -1;
+        engine->LogSizeTotal += (ImU64)test_output->Log.Buffer.size();
+        engine->LogLinesTotal += test_output->Log.LineInfo.Size;
+        engine->LogSizeTestsCount++;
+    }
+
+    // 'ctx' at this point is either a pooled context or shared with parent.
     //ctx->Test = nullptr;
     //ctx->TestOutput = nullptr;
     //ctx->CaptureArgs = nullptr;
@@ -2000,6 +2917,7 @@ void ImGuiTestEngine_RunTest(ImGuiTestEngine* engine, ImGuiTestContext* parent_c
 static void LogAsWarningFunc(void* user_data, const char* fmt, ...)
 {
     ImGuiTestContext* ctx = (ImGuiTestContext*)user_data;
+    ctx->ErrorRecoveredCounter++;
     va_list args;
     va_start(args, fmt);
     ctx->LogExV(ImGuiTestVerboseLevel_Warning, ImGuiTestLogFlags_None, fmt, args);
@@ -2009,6 +2927,7 @@ static void LogAsWarningFunc(void* user_data, const char* fmt, ...)
 static void LogAsDebugFunc(void* user_data, const char* fmt, ...)
 {
     ImGuiTestContext* ctx = (ImGuiTestContext*)user_data;
+    ctx->ErrorRecoveredCounter++;
     va_list args;
     va_start(args, fmt);
     ctx->LogExV(ImGuiTestVerboseLevel_Debug, ImGuiTestLogFlags_None, fmt, args);
@@ -2019,6 +2938,7 @@ static void LogAsWarningFunc(ImGuiContext*, void* user_data, const char* msg)
 {
     ImGuiContext& g = *GImGui;
     ImGuiTestContext* ctx = (ImGuiTestContext*)user_data;
+    ctx->ErrorRecoveredCounter++;
     ImGuiWindow* window = g.CurrentWindow;
     ctx->LogEx(ImGuiTestVerboseLevel_Warning, ImGuiTestLogFlags_None, "In '%s': %s", window ? window->Name : "nullptr", msg);
 }
@@ -2026,6 +2946,7 @@ static void LogAsDebugFunc(ImGuiContext*, void* user_data, const char* msg)
 {
     ImGuiContext& g = *GImGui;
     ImGuiTestContext* ctx = (ImGuiTestContext*)user_data;
+    ctx->ErrorRecoveredCounter++;
     ImGuiWindow* window = g.CurrentWindow;
     ctx->LogEx(ImGuiTestVerboseLevel_Debug, ImGuiTestLogFlags_None, "In '%s': %s", window ? window->Name : "nullptr", msg);
 }
@@ -2109,7 +3030,8 @@ void ImGuiTestEngine_CrashHandler()
         crashed_test->Output.EndTime = engine->BatchEndTime;
     }
 
-    // Export test run results.
+    // Export test run results. (don't start threads from a crash handler)
+    engine->IO.ExportResultsThreads = 1;
     ImGuiTestEngine_Export(engine);
     ImGuiTestEngine_PrintResultSummary(engine);
 }
@@ -2153,80 +3075,140 @@ void ImGuiTestEngine_InstallDefaultCrashHandler()
 //-------------------------------------------------------------------------
 // - ImGuiTestEngineHook_ItemAdd()
 // - ImGuiTestEngineHook_ItemAdd_GatherTask()
+// - ImGuiTestEngineHook_ItemAdd_ItemGraph()
 // - ImGuiTestEngineHook_ItemInfo()
 // - ImGuiTestEngineHook_ItemInfo_ResolveFindByLabel()
 // - ImGuiTestEngineHook_Log()
 // - ImGuiTestEngineHook_AssertFunc()
 //-------------------------------------------------------------------------
 
+static void ImGuiTestEngineHook_ItemAdd_GatherTaskOutput(ImGuiTestEngine* engine, ImGuiTestGatherTask* task, ImGuiWindow* window, ImGuiID id, ImGuiID parent_id, int result_depth, const ImRect& bb, const ImGuiLastItemData* item_data)
+{
+    ImGuiTestItemInfo* item = task->OutList->Pool.GetOrAddByKey(id); // Add
+    item->TimestampMain = engine->FrameCount;
+    item->ID = id;
+    item->ParentID = parent_id;
+    item->Window = window;
+    item->RectFull = item->RectClipped = bb;
+    item->RectClipped.ClipWithFull(window->ClipRect);      // This two step clipping is important, we want RectClipped to stays within RectFull
+    item->RectClipped.ClipWithFull(item->RectFull);
+    item->NavLayer = window->DC.NavLayerCurrent;
+    item->Depth = result_depth;
+#if IMGUI_VERSION_NUM >= 19135
+    item->ItemFlags = item_data ? item_data->ItemFlags : ImGuiItemFlags_None;
+#else
+    item->ItemFlags = item_data ? item_data->InFlags : ImGuiItemFlags_None;
+#endif
+    item->StatusFlags = item_data ? item_data->StatusFlags : ImGuiItemStatusFlags_None;
+    task->LastItemInfo = item;
+    task->LastItemSerial = engine->GatherItemSerial;
+}
+
 // This is rather slow at it runs on all items but only during a GatherItems() operations.
+// All active tasks are served by a single walk of the ID Stack: each entry is checked against the set of requested parents.
 static void ImGuiTestEngineHook_ItemAdd_GatherTask(ImGuiContext* ui_ctx, ImGuiTestEngine* engine, ImGuiID id, const ImRect& bb, const ImGuiLastItemData* item_data)
 {
     ImGuiContext& g = *ui_ctx;
     ImGuiWindow* window = g.CurrentWindow;
-    ImGuiTestGatherTask* task = &engine->GatherTask;
+    const short layer_bit = (short)(1 << window->DC.NavLayerCurrent);
+    const ImGuiID parent_id = window->IDStack.Size ? window->IDStack.back() : 0;
+    const int max_depth = engine->GatherTasksMaxDepth;
+    engine->GatherItemSerial++;
 
-    if ((task->InLayerMask & (1 << window->DC.NavLayerCurrent)) == 0)
-        return;
+    // When using a 'PushID(label); Widget(""); PopID();` pattern flatten as 1 deep instead of 2 for simplicity.
+    // We do this by offsetting our depth level. Immediate parent is always reported as depth 0.
+    int curr_depth = (id == parent_id) ? -1 : 0;
 
-    const ImGuiID parent_id = window->IDStack.Size ? window->IDStack.back() : 0;
-    const ImGuiID gather_parent_id = task->InParentID;
-    int result_depth = -1;
-    if (gather_parent_id == parent_id)
+    ImGuiWindow* curr_window = window;
+    while (curr_window != nullptr && curr_depth < max_depth)
     {
-        result_depth = 0;
+        const int id_stack_size = curr_window->IDStack.Size;
+        for (ImGuiID* p_id_stack = curr_window->IDStack.Data + id_stack_size - 1; p_id_stack >= curr_window->IDStack.Data; p_id_stack--, curr_depth++)
+        {
+            const ImGuiID stack_id = *p_id_stack;
+            const bool is_immediate_parent = (curr_window == window && p_id_stack == curr_window->IDStack.Data + id_stack_size - 1);
+            if (curr_depth >= max_depth && !is_immediate_parent)
+                break;
+            if ((engine->GatherTasksParentMask & ((ImU64)1 << (stack_id & 63))) == 0 || engine->GatherTasksParentIds.GetInt(stack_id) == 0)
+                continue;
+            const int result_depth = is_immediate_parent ? 0 : curr_depth;
+            for (ImGuiTestGatherTask* task : engine->GatherTasks)
+            {
+                if (task->InParentID != stack_id || task->LastItemSerial == engine->GatherItemSerial)
+                    continue;
+                if ((task->InLayerMask & layer_bit) == 0 || (result_depth >= task->InMaxDepth && !is_immediate_parent))
+                    continue;
+                ImGuiTestEngineHook_ItemAdd_GatherTaskOutput(engine, task, window, id, parent_id, result_depth, bb, item_data);
+            }
+        }
+
+        // Recurse in child (could be policy/option in GatherTask)
+        if (curr_window->Flags & ImGuiWindowFlags_ChildWindow)
+            curr_window = curr_window->ParentWindow;
+        else
+            curr_window = nullptr;
     }
-    else
-    {
-        const int max_depth = task->InMaxDepth;
+}
 
-        // When using a 'PushID(label); Widget(""); PopID();` pattern flatten as 1 deep instead of 2 for simplicity.
-        // We do this by offsetting our depth level.
-        int curr_depth = (id == parent_id) ? -1 : 0;
+// Record item and the ID Stack links leading to it.
+// ID Stack walk stops at the first entry already linked this frame, so the cost is amortized to O(1) per item.
+static void ImGuiTestEngineHook_ItemAdd_ItemGraph(ImGuiContext* ui_ctx, ImGuiTestEngine* engine, ImGuiID id, const ImRect& bb, const ImGuiLastItemData* item_data)
+{
+    ImGuiContext& g = *ui_ctx;
+    ImGuiWindow* window = g.CurrentWindow;
+    ImGuiTestItemGraph* graph = &engine->ItemGraph;
+    const int frame_count = engine->FrameCount;
+    if (graph->SubmitFrame != frame_count)
+    {
+        graph->SubmitFrame = frame_count;
+        graph->SubmitCount = 0;
+    }
 
-        ImGuiWindow* curr_window = window;
-        while (result_depth == -1 && curr_window != nullptr)
+    for (ImGuiWindow* curr_window = window; curr_window != nullptr; curr_window = (curr_window->Flags & ImGuiWindowFlags_ChildWindow) ? curr_window->ParentWindow : nullptr)
+    {
+        bool stop = false;
+        for (int n = curr_window->IDStack.Size - 1; n >= 0; n--)
         {
-            const int id_stack_size = curr_window->IDStack.Size;
-            for (ImGuiID* p_id_stack = curr_window->IDStack.Data + id_stack_size - 1; p_id_stack >= curr_window->IDStack.Data; p_id_stack--, curr_depth++)
+            ImGuiTestItemGraphLink* link = graph->Links.GetOrAddByKey(curr_window->IDStack[n]);
+            if (link->LinkFrame == frame_count)
             {
-                if (curr_depth >= max_depth)
-                    break;
-                if (*p_id_stack == gather_parent_id)
-                {
-                    result_depth = curr_depth;
-                    break;
-                }
+                stop = true;
+                break;
             }
-
-            // Recurse in child (could be policy/option in GatherTask)
-            if (curr_window->Flags & ImGuiWindowFlags_ChildWindow)
-                curr_window = curr_window->ParentWindow;
+            if (n > 0)
+                link->ParentID = curr_window->IDStack[n - 1];
+            else if ((curr_window->Flags & ImGuiWindowFlags_ChildWindow) && curr_window->ParentWindow && curr_window->ParentWindow->IDStack.Size > 0)
+                link->ParentID = curr_window->ParentWindow->IDStack.back();
             else
-                curr_window = nullptr;
+                link->ParentID = 0;
+            link->LinkFrame = frame_count;
         }
+        if (stop)
+            break;
     }
 
-    if (result_depth != -1)
-    {
-        ImGuiTestItemInfo* item = task->OutList->Pool.GetOrAddByKey(id); // Add
-        item->TimestampMain = engine->FrameCount;
-        item->ID = id;
-        item->ParentID = parent_id;
-        item->Window = window;
-        item->RectFull = item->RectClipped = bb;
-        item->RectClipped.ClipWithFull(window->ClipRect);      // This two step clipping is important, we want RectClipped to stays within RectFull
-        item->RectClipped.ClipWithFull(item->RectFull);
-        item->NavLayer = window->DC.NavLayerCurrent;
-        item->Depth = result_depth;
+    ImGuiTestItemGraphItem* graph_item = graph->Items.GetOrAddByKey(id);
+    ImGuiTestItemInfo* item = &graph_item->Info;
+    if (item->TimestampMain != frame_count)
+        graph_item->SubmitOrder = graph->SubmitCount++;
+    if (graph_item->AppearFrame == -1 || item->TimestampMain < frame_count - 1)
+        graph_item->AppearFrame = frame_count;
+    item->TimestampMain = frame_count;
+    item->ID = id;
+    item->ParentID = window->IDStack.Size ? window->IDStack.back() : 0;
+    item->Window = window;
+    item->RectFull = item->RectClipped = bb;
+    item->RectClipped.ClipWithFull(window->ClipRect);      // This two step clipping is important, we want RectClipped to stays within RectFull
+    item->RectClipped.ClipWithFull(item->RectFull);
+    item->NavLayer = window->DC.NavLayerCurrent;
+    item->Depth = 0;
 #if IMGUI_VERSION_NUM >= 19135
-        item->ItemFlags = item_data ? item_data->ItemFlags : ImGuiItemFlags_None;
+    item->ItemFlags = item_data ? item_data->ItemFlags : ImGuiItemFlags_None;
 #else
-        item->ItemFlags = item_data ? item_data->InFlags : ImGuiItemFlags_None;
+    item->ItemFlags = item_data ? item_data->InFlags : ImGuiItemFlags_None;
 #endif
-        item->StatusFlags = item_data ? item_data->StatusFlags : ImGuiItemStatusFlags_None;
-        task->LastItemInfo = item;
-    }
+    item->StatusFlags = item_data ? item_data->StatusFlags : ImGuiItemStatusFlags_None;
+    graph->LastItem = graph_item;
 }
 
 void ImGuiTestEngineHook_ItemAdd(ImGuiContext* ui_ctx, ImGuiID id, const ImRect& bb, const ImGuiLastItemData* item_data)
@@ -2261,9 +3243,13 @@ void ImGuiTestEngineHook_ItemAdd(ImGuiContext* ui_ctx, ImGuiID id, const ImRect&
         item->StatusFlags = item_data ? item_data->StatusFlags : ImGuiItemStatusFlags_None;
     }
 
-    // Gather Task (only 1 can be active)
-    if (engine->GatherTask.InParentID != 0)
+    // Gather Tasks
+    if (engine->GatherTasks.Size > 0)
         ImGuiTestEngineHook_ItemAdd_GatherTask(ui_ctx, engine, id, bb, item_data);
+
+    // Item Graph
+    if (engine->ItemGraph.FirstFrame != -1)
+        ImGuiTestEngineHook_ItemAdd_ItemGraph(ui_ctx, engine, id, bb, item_data);
 }
 
 #if IMGUI_VERSION_NUM < 18934
@@ -2376,10 +3362,21 @@ void ImGuiTestEngineHook_ItemInfo(ImGuiContext* ui_ctx, ImGuiID id, const char*
             ImStrncpy(item->DebugLabel, label, IM_COUNTOF(item->DebugLabel));
     }
 
-    // Update Gather Task status flags
-    if (engine->GatherTask.LastItemInfo && engine->GatherTask.LastItemInfo->ID == id)
+    // Update Gather Tasks status flags
+    for (ImGuiTestGatherTask* task : engine->GatherTasks)
+        if (task->LastItemInfo && task->LastItemInfo->ID == id)
+        {
+            ImGuiTestItemInfo* item = task->LastItemInfo;
+            item->TimestampStatus = g.FrameCount;
+            item->StatusFlags = flags;
+            if (label)
+                ImStrncpy(item->DebugLabel, label, IM_COUNTOF(item->DebugLabel));
+        }
+
+    // Update Item Graph status flags
+    if (engine->ItemGraph.LastItem && engine->ItemGraph.LastItem->Info.ID == id)
     {
-        ImGuiTestItemInfo* item = engine->GatherTask.LastItemInfo;
+        ImGuiTestItemInfo* item = &engine->ItemGraph.LastItem->Info;
         item->TimestampStatus = g.FrameCount;
         item->StatusFlags = flags;
         if (label)
@@ -2566,6 +3563,351 @@ bool ImGuiTestEngine_Error(const char* file, const char* func, int line, ImGuiTe
     return ret;
 }
 
+//-------------------------------------------------------------------------
+// [SECTION] INPUT RECORDING
+//-------------------------------------------------------------------------
+// - ImGuiTestEngine_InputRecordBegin()
+// - ImGuiTestEngine_InputRecordEnd()
+// - ImGuiTestEngine_IsInputRecording()
+// - ImGuiTestInputRecording
+// - ImGuiTestInputRecordingReader
+//-------------------------------------------------------------------------
+
+void ImGuiTestEngine_InputRecordBegin(ImGuiTestEngine* engine)
+{
+    if (engine->InputRecording == nullptr)
+        engine->InputRecording = IM_NEW(ImGuiTestInputRecording)();
+    engine->InputRecording->Clear();
+
+    // Events already in queue were submitted before recording started.
+    engine->InputRecordingQueueSkip = engine->UiContextTarget ? engine->UiContextTarget->InputEventsQueue.Size : 0;
+}
+
+bool ImGuiTestEngine_InputRecordEnd(ImGuiTestEngine* engine, const char* filename)
+{
+    ImGuiTestInputRecording* recording = engine->InputRecording;
+    if (recording == nullptr)
+        return false;
+    engine->InputRecording = nullptr;
+
+    bool ret = true;
+    if (filename != nullptr)
+    {
+        ret = recording->SaveToFile(filename);
+        if (ret)
+            fprintf(stdout, "Saved input recording to '%s' (%d frames, %d events, %d bytes)\n", filename, recording->FrameCount, recording->EventCount, recording->Data.Size);
+        else
+            fprintf(stderr, "Unable to save input recording to '%s'.\n", filename);
+    }
+    IM_DELETE(recording);
+    return ret;
+}
+
+bool ImGuiTestEngine_IsInputRecording(ImGuiTestEngine* engine)
+{
+    return engine->InputRecording != nullptr;
+}
+
+// Event types in encoded stream. Those values are serialized: only append new ones.
+enum ImGuiTestInputRecordingEventType_
+{
+    ImGuiTestInputRecordingEventType_MousePos           = 1,    // zigzag dx, zigzag dy
+    ImGuiTestInputRecordingEventType_MousePosInvalid    = 2,    //
+    ImGuiTestInputRecordingEventType_MouseButton        = 3,    // (button << 1) | down
+    ImGuiTestInputRecordingEventType_MouseWheel         = 4,    // float x, float y
+    ImGuiTestInputRecordingEventType_Key                = 5,    // key, (has_analog << 1) | down, [float analog]
+    ImGuiTestInputRecordingEventType_Text               = 6,    // char
+};
+
+static const char   ImGuiTestInputRecordingFileMagic[] = "IMREC";
+static const int    ImGuiTestInputRecordingFileVersion = 1;
+
+static void ImGuiTestInputRecording_WriteVarint(ImVector<unsigned char>* buf, ImU32 v)
+{
+    while (v >= 0x80)
+    {
+        buf->push_back((unsigned char)(v | 0x80));
+        v >>= 7;
+    }
+    buf->push_back((unsigned char)v);
+}
+
+static void ImGuiTestInputRecording_WriteSignedVarint(ImVector<unsigned char>* buf, int v)
+{
+    ImGuiTestInputRecording_WriteVarint(buf, ((ImU32)v << 1) ^ (ImU32)(v >> 31)); // ZigZag encoding
+}
+
+static void ImGuiTestInputRecording_WriteFloat(ImVector<unsigned char>* buf, float v)
+{
+    unsigned char bytes[sizeof(float)];
+    memcpy(bytes, &v, sizeof(float));
+    for (unsigned char b : bytes)
+        buf->push_back(b);
+}
+
+static bool ImGuiTestInputRecording_ReadVarint(const ImVector<unsigned char>& buf, int* p_offset, ImU32* out_v)
+{
+    ImU32 v = 0;
+    for (int shift = 0; shift < 35; shift += 7)
+    {
+        if (*p_offset >= buf.Size)
+            return false;
+        const unsigned char b = buf.Data[(*p_offset)++];
+        v |= (ImU32)(b & 0x7F) << shift;
+        if ((b & 0x80) == 0)
+        {
+            *out_v = v;
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool ImGuiTestInputRecording_ReadSignedVarint(const ImVector<unsigned char>& buf, int* p_offset, int* out_v)
+{
+    ImU32 v;
+    if (!ImGuiTestInputRecording_ReadVarint(buf, p_offset, &v))
+        return false;
+    *out_v = (int)(v >> 1) ^ -(int)(v & 1);
+    return true;
+}
+
+static bool ImGuiTestInputRecording_ReadFloat(const ImVector<unsigned char>& buf, int* p_offset, float* out_v)
+{
+    if (*p_offset + (int)sizeof(float) > buf.Size)
+        return false;
+    memcpy(out_v, buf.Data + *p_offset, sizeof(float));
+    *p_offset += (int)sizeof(float);
+    return true;
+}
+
+void ImGuiTestInputRecording::Clear()
+{
+    Data.clear();
+    _FrameData.clear();
+    FrameCount = EventCount = 0;
+    _FrameEventCount = _PendingFrames = 0;
+    _PendingTime = 0.0;
+    _MouseX = _MouseY = 0;
+}
+
+// Write pending frames and events of last frame as a single record
+static void ImGuiTestInputRecording_WriteRecord(ImGuiTestInputRecording* recording)
+{
+    ImVector<unsigned char>* buf = &recording->Data;
+    ImGuiTestInputRecording_WriteVarint(buf, (ImU32)recording->_PendingFrames);
+    ImGuiTestInputRecording_WriteVarint(buf, (ImU32)(recording->_PendingTime * 1000000.0 + 0.5));
+    ImGuiTestInputRecording_WriteVarint(buf, (ImU32)recording->_FrameEventCount);
+    const int offset = buf->Size;
+    buf->resize(buf->Size + recording->_FrameData.Size);
+    if (recording->_FrameData.Size > 0)
+        memcpy(buf->Data + offset, recording->_FrameData.Data, (size_t)recording->_FrameData.Size);
+    recording->_FrameData.resize(0);
+    recording->_FrameEventCount = 0;
+    recording->_PendingFrames = 0;
+    recording->_PendingTime = 0.0;
+}
+
+void ImGuiTestInputRecording::AddFrame(float delta_time)
+{
+    // Events of previous frame are written when next frame starts, so consecutive frames without events are merged into next record.
+    if (_FrameEventCount > 0)
+        ImGuiTestInputRecording_WriteRecord(this);
+    _PendingFrames++;
+    _PendingTime += delta_time;
+    FrameCount++;
+}
+
+void ImGuiTestInputRecording::AddEvent(const ImGuiInputEvent* e)
+{
+    ImVector<unsigned char>* buf = &_FrameData;
+    switch (e->Type)
+    {
+    case ImGuiInputEventType_MousePos:
+    {
+        ImVec2 pos(e->MousePos.PosX, e->MousePos.PosY);
+        if (!ImGui::IsMousePosValid(&pos))
+        {
+            buf->push_back(ImGuiTestInputRecordingEventType_MousePosInvalid);
+            break;
+        }
+        const int x = (int)ImFloor(pos.x * 16.0f + 0.5f);
+        const int y = (int)ImFloor(pos.y * 16.0f + 0.5f);
+        buf->push_back(ImGuiTestInputRecordingEventType_MousePos);
+        ImGuiTestInputRecording_WriteSignedVarint(buf, x - _MouseX);
+        ImGuiTestInputRecording_WriteSignedVarint(buf, y - _MouseY);
+        _MouseX = x;
+        _MouseY = y;
+        break;
+    }
+    case ImGuiInputEventType_MouseButton:
+        buf->push_back(ImGuiTestInputRecordingEventType_MouseButton);
+        buf->push_back((unsigned char)((e->MouseButton.Button << 1) | (e->MouseButton.Down ? 1 : 0)));
+        break;
+    case ImGuiInputEventType_MouseWheel:
+        buf->push_back(ImGuiTestInputRecordingEventType_MouseWheel);
+        ImGuiTestInputRecording_WriteFloat(buf, e->MouseWheel.WheelX);
+        ImGuiTestInputRecording_WriteFloat(buf, e->MouseWheel.WheelY);
+        break;
+    case ImGuiInputEventType_Key:
+    {
+        // Only store analog value when it differs from the one implied by Down (e.g. gamepad sticks/triggers)
+        const bool has_analog_value = e->Key.AnalogValue != (e->Key.Down ? 1.0f : 0.0f);
+        buf->push_back(ImGuiTestInputRecordingEventType_Key);
+        ImGuiTestInputRecording_WriteVarint(buf, (ImU32)e->Key.Key);
+        buf->push_back((unsigned char)((has_analog_value ? 2 : 0) | (e->Key.Down ? 1 : 0)));
+        if (has_analog_value)
+            ImGuiTestInputRecording_WriteFloat(buf, e->Key.AnalogValue);
+        break;
+    }
+    case ImGuiInputEventType_Text:
+        buf->push_back(ImGuiTestInputRecordingEventType_Text);
+        ImGuiTestInputRecording_WriteVarint(buf, (ImU32)e->Text.Char);
+        break;
+    default:
+        return; // Focus, MouseViewport: not recorded.
+    }
+    _FrameEventCount++;
+    EventCount++;
+}
+
+void ImGuiTestInputRecording::Finish()
+{
+    // Events of last frame, or trailing frames without events
+    if (_FrameEventCount > 0 || _PendingFrames > 0)
+        ImGuiTestInputRecording_WriteRecord(this);
+}
+
+bool ImGuiTestInputRecording::SaveToFile(const char* filename)
+{
+    Finish();
+
+    if (!ImFileCreateDirectoryChain(filename, ImPathFindFilename(filename)))
+        return false;
+    FILE* f = fopen(filename, "wb");
+    if (f == nullptr)
+        return false;
+    const unsigned char header_version = (unsigned char)ImGuiTestInputRecordingFileVersion;
+    fwrite(ImGuiTestInputRecordingFileMagic, 1, sizeof(ImGuiTestInputRecordingFileMagic) - 1, f);
+    fwrite(&header_version, 1, 1, f);
+    const bool ret = fwrite(Data.Data, 1, (size_t)Data.Size, f) == (size_t)Data.Size;
+    fclose(f);
+    return ret;
+}
+
+bool ImGuiTestInputRecording::LoadFromFile(const char* filename)
+{
+    Clear();
+
+    size_t file_size = 0;
+    unsigned char* file_data = (unsigned char*)ImFileLoadToMemory(filename, "rb", &file_size);
+    if (file_data == nullptr)
+        return false;
+
+    const size_t header_size = sizeof(ImGuiTestInputRecordingFileMagic);  // Magic + version byte
+    bool ret = file_size >= header_size && memcmp(file_data, ImGuiTestInputRecordingFileMagic, header_size - 1) == 0 && file_data[header_size - 1] == ImGuiTestInputRecordingFileVersion;
+    if (ret)
+    {
+        Data.resize((int)(file_size - header_size));
+        memcpy(Data.Data, file_data + header_size, (size_t)Data.Size);
+
+        // Calculate statistics
+        ImGuiTestInputRecordingReader reader(this);
+        while (reader.ReadFrame())
+        {
+            FrameCount += reader.FrameCount;
+            EventCount += reader.Events.Size;
+        }
+    }
+    IM_FREE(file_data);
+    return ret;
+}
+
+bool ImGuiTestInputRecordingReader::ReadFrame()
+{
+    const ImVector<unsigned char>& buf = Recording->Data;
+    Events.resize(0);
+    ImU32 frame_count, time_us, event_count;
+    if (!ImGuiTestInputRecording_ReadVarint(buf, &Offset, &frame_count) || !ImGuiTestInputRecording_ReadVarint(buf, &Offset, &time_us) || !ImGuiTestInputRecording_ReadVarint(buf, &Offset, &event_count))
+        return false;
+    FrameCount = (int)frame_count;
+    DeltaTime = (float)(time_us / 1000000.0);
+
+    for (ImU32 event_n = 0; event_n < event_count; event_n++)
+    {
+        if (Offset >= buf.Size)
+            return false;
+        ImGuiInputEvent e;
+        e.Source = ImGuiInputSource_Mouse;
+        const int type = buf.Data[Offset++];
+        bool ok = true;
+        switch (type)
+        {
+        case ImGuiTestInputRecordingEventType_MousePos:
+        {
+            int dx = 0, dy = 0;
+            ok = ImGuiTestInputRecording_ReadSignedVarint(buf, &Offset, &dx) && ImGuiTestInputRecording_ReadSignedVarint(buf, &Offset, &dy);
+            MouseX += dx;
+            MouseY += dy;
+            e.Type = ImGuiInputEventType_MousePos;
+            e.MousePos.PosX = MouseX / 16.0f;
+            e.MousePos.PosY = MouseY / 16.0f;
+            break;
+        }
+        case ImGuiTestInputRecordingEventType_MousePosInvalid:
+            e.Type = ImGuiInputEventType_MousePos;
+            e.MousePos.PosX = e.MousePos.PosY = -FLT_MAX;
+            break;
+        case ImGuiTestInputRecordingEventType_MouseButton:
+            ok = Offset < buf.Size;
+            if (ok)
+            {
+                e.Type = ImGuiInputEventType_MouseButton;
+                e.MouseButton.Button = buf.Data[Offset] >> 1;
+                e.MouseButton.Down = (buf.Data[Offset] & 1) != 0;
+                Offset++;
+            }
+            break;
+        case ImGuiTestInputRecordingEventType_MouseWheel:
+            e.Type = ImGuiInputEventType_MouseWheel;
+            ok = ImGuiTestInputRecording_ReadFloat(buf, &Offset, &e.MouseWheel.WheelX) && ImGuiTestInputRecording_ReadFloat(buf, &Offset, &e.MouseWheel.WheelY);
+            break;
+        case ImGuiTestInputRecordingEventType_Key:
+        {
+            ImU32 key = 0;
+            ok = ImGuiTestInputRecording_ReadVarint(buf, &Offset, &key) && Offset < buf.Size;
+            if (!ok)
+                break;
+            const int key_flags = buf.Data[Offset++];
+            e.Type = ImGuiInputEventType_Key;
+            e.Source = ImGuiInputSource_Keyboard;
+            e.Key.Key = (ImGuiKey)key;
+            e.Key.Down = (key_flags & 1) != 0;
+            e.Key.AnalogValue = e.Key.Down ? 1.0f : 0.0f;
+            if (key_flags & 2)
+                ok = ImGuiTestInputRecording_ReadFloat(buf, &Offset, &e.Key.AnalogValue);
+            break;
+        }
+        case ImGuiTestInputRecordingEventType_Text:
+        {
+            ImU32 c = 0;
+            ok = ImGuiTestInputRecording_ReadVarint(buf, &Offset, &c);
+            e.Type = ImGuiInputEventType_Text;
+            e.Source = ImGuiInputSource_Keyboard;
+            e.Text.Char = (unsigned int)c;
+            break;
+        }
+        default:
+            ok = false;
+            break;
+        }
+        if (!ok)
+            return false;
+        Events.push_back(e);
+    }
+    return true;
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] SETTINGS
 //-------------------------------------------------------------------------
@@ -2651,10 +3993,18 @@ static void     ImGuiTestEngine_SettingsWriteAll(ImGuiContext* ui_ctx, ImGuiSett
 // [SECTION] ImGuiTestLog
 //-------------------------------------------------------------------------
 
+// Keep capacity: a test being run again will generally log a similar amount.
 void ImGuiTestLog::Clear()
 {
-    Buffer.clear();
-    LineInfo.clear();
+    if (Buffer.Buf.Capacity > 0)
+    {
+        Buffer.Buf.resize(1);
+        Buffer.Buf[0] = 0;
+    }
+    LineInfo.resize(0);
+    LineBlocks.resize(0);
+    SearchIndex.resize(0);
+    SearchIndexLines = 0;
     memset(&CountPerLevel, 0, sizeof(CountPerLevel));
 }
 
@@ -2680,17 +4030,144 @@ int ImGuiTestLog::ExtractLinesForVerboseLevels(ImGuiTestVerboseLevel level_min,
     }
 
     // Extract lines and return count
+    // (no filtering needed when all lines are within requested levels: copy whole buffer)
+    int total_count = 0;
+    for (int n = level_min; n <= level_max; n++)
+        total_count += CountPerLevel[n];
+    if (total_count == LineInfo.Size && total_count > 0)
+    {
+        out_buffer->append(Buffer.begin(), Buffer.end());
+        return total_count;
+    }
+
+    // Process runs of consecutive lines with a single append
+    const char* buf = Buffer.c_str();
+    const char* buf_end = Buffer.end();
+    const char* run_begin = nullptr;
+    const char* run_end = nullptr;
     for (auto& line_info : LineInfo)
-        if (line_info.Level >= level_min && line_info.Level <= level_max)
+    {
+        if (line_info.Level < level_min || line_info.Level > level_max)
+            continue;
+        const char* line_begin = buf + line_info.LineOffset;
+        const char* line_end = line_begin + line_info.LineLength;
+        if (line_end < buf_end && line_end[0] == '\n')
+            line_end++;
+        if (run_end != line_begin)
         {
-            const char* line_begin = Buffer.c_str() + line_info.LineOffset;
-            const char* line_end = strchr(line_begin, '\n');
-            out_buffer->append(line_begin, line_end[0] == '\n' ? line_end + 1 : line_end);
-            count++;
+            if (run_begin != nullptr)
+                out_buffer->append(run_begin, run_end);
+            run_begin = line_begin;
         }
+        run_end = line_end;
+        count++;
+    }
+    if (run_begin != nullptr)
+        out_buffer->append(run_begin, run_end);
     return count;
 }
 
+int ImGuiTestLog::FindLineIndexForVerboseLevels(ImGuiTestVerboseLevel level_min, ImGuiTestVerboseLevel level_max, int filtered_line_no)
+{
+    IM_ASSERT(level_min <= level_max);
+    if (filtered_line_no < 0 || LineBlocks.Size == 0)
+        return -1;
+
+    // Binary search last block starting at or before requested line
+    int block_lo = 0;
+    int block_hi = LineBlocks.Size - 1;
+    while (block_lo < block_hi)
+    {
+        const int block_mid = (block_lo + block_hi + 1) / 2;
+        int count_before = 0;
+        for (int level = level_min; level <= level_max; level++)
+            count_before += LineBlocks[block_mid].CountPerLevel[level];
+        if (count_before <= filtered_line_no)
+            block_lo = block_mid;
+        else
+            block_hi = block_mid - 1;
+    }
+
+    // Scan lines within block (and following blocks if they have no matching lines)
+    int filtered_n = 0;
+    for (int level = level_min; level <= level_max; level++)
+        filtered_n += LineBlocks[block_lo].CountPerLevel[level];
+    for (int line_n = block_lo * IMGUI_TEST_LOG_LINES_PER_BLOCK; line_n < LineInfo.Size; line_n++)
+    {
+        const ImGuiTestVerboseLevel level = LineInfo[line_n].Level;
+        if (level < level_min || level > level_max)
+            continue;
+        if (filtered_n == filtered_line_no)
+            return line_n;
+        filtered_n++;
+    }
+    return -1;
+}
+
+static inline ImU32 ImGuiTestLog_GetTrigram(const char* p)
+{
+    return ((ImU32)(unsigned char)ImToUpper(p[0]) << 16) | ((ImU32)(unsigned char)ImToUpper(p[1]) << 8) | (ImU32)(unsigned char)ImToUpper(p[2]);
+}
+
+// Set bit of a hashed trigram in a 128-bit line signature (2 x ImU64)
+static inline void ImGuiTestLog_AddTrigramToSignature(ImU64* signature, ImU32 trigram)
+{
+    const ImU32 bit = (trigram * 2654435761u) >> 25;
+    signature[bit >> 6] |= (ImU64)1 << (bit & 63);
+}
+
+// Index lines added since last call: one signature per line, so index size is proportional to number of lines (16 bytes per line).
+void ImGuiTestLog::UpdateSearchIndex()
+{
+    const char* buf = Buffer.c_str();
+    SearchIndex.resize(LineInfo.Size * IMGUI_TEST_LOG_SEARCH_SIGNATURE_SIZE);
+    for (int line_idx = SearchIndexLines; line_idx < LineInfo.Size; line_idx++)
+    {
+        ImU64* signature = &SearchIndex[line_idx * IMGUI_TEST_LOG_SEARCH_SIGNATURE_SIZE];
+        signature[0] = signature[1] = 0;
+        const char* line_begin = buf + LineInfo[line_idx].LineOffset;
+        for (int n = 0; n + 3 <= LineInfo[line_idx].LineLength; n++)
+            ImGuiTestLog_AddTrigramToSignature(signature, ImGuiTestLog_GetTrigram(line_begin + n));
+    }
+    SearchIndexLines = LineInfo.Size;
+}
+
+int ImGuiTestLog::Search(const char* query, ImVector<int>* out_lines)
+{
+    IM_ASSERT(query != nullptr && out_lines != nullptr);
+    const char* query_end = query + strlen(query);
+    const int query_len = (int)(query_end - query);
+    const int count_before = out_lines->Size;
+    if (query_len == 0)
+        return 0;
+
+    // Short queries: scan all lines
+    const char* buf = Buffer.c_str();
+    if (query_len < 3)
+    {
+        for (int line_idx = 0; line_idx < LineInfo.Size; line_idx++)
+            if (ImStristr(buf + LineInfo[line_idx].LineOffset, buf + LineInfo[line_idx].LineOffset + LineInfo[line_idx].LineLength, query, query_end))
+                out_lines->push_back(line_idx);
+        return out_lines->Size - count_before;
+    }
+
+    // Only verify lines whose signature contains all trigrams of query
+    UpdateSearchIndex();
+    ImU64 query_signature[IMGUI_TEST_LOG_SEARCH_SIGNATURE_SIZE] = {};
+    for (int n = 0; n + 3 <= query_len; n++)
+        ImGuiTestLog_AddTrigramToSignature(query_signature, ImGuiTestLog_GetTrigram(query + n));
+    const ImU64* signature = SearchIndex.Data;
+    for (int line_idx = 0; line_idx < LineInfo.Size; line_idx++, signature += IMGUI_TEST_LOG_SEARCH_SIGNATURE_SIZE)
+    {
+        if ((signature[0] & query_signature[0]) != query_signature[0] || (signature[1] & query_signature[1]) != query_signature[1])
+            continue;
+        const char* line_begin = buf + LineInfo[line_idx].LineOffset;
+        if (ImStristr(line_begin, line_begin + LineInfo[line_idx].LineLength, query, query_end))
+            out_lines->push_back(line_idx);
+    }
+    return out_lines->Size - count_before;
+}
+
 void ImGuiTestLog::UpdateLineOffsets(ImGuiTestEngineIO* engine_io, ImGuiTestVerboseLevel level, const char* start)
 {
     IM_UNUSED(engine_io);
@@ -2706,8 +4183,15 @@ void ImGuiTestLog::UpdateLineOffsets(ImGuiTestEngineIO* engine_io, ImGuiTestVerb
         bool last_empty_line = (p_bol + 1 == p_end);
         if (!last_empty_line)
         {
+            if ((LineInfo.Size % IMGUI_TEST_LOG_LINES_PER_BLOCK) == 0)
+            {
+                ImGuiTestLogLineBlock block;
+                memcpy(block.CountPerLevel, CountPerLevel, sizeof(CountPerLevel));
+                LineBlocks.push_back(block);
+            }
             int offset = (int)(p_bol - Buffer.c_str());
-            LineInfo.push_back({level, offset});
+            int length = (int)((p_eol ? p_eol : p_end) - p_bol);
+            LineInfo.push_back({level, offset, length});
             CountPerLevel[level] += 1;
         }
         p = p_eol ? p_eol + 1 : nullptr;
@@ -34,6 +34,9 @@
 
 #include "imgui_capture_tool.h"     // ImGuiScreenCaptureFunc
 
+// Configuration
+#define IMGUI_TEST_ENGINE_INPUT_RECORDING_DEFAULT_FILENAME  "output/imgui_input_recording.bin"
+
 //-------------------------------------------------------------------------
 // Forward Declarations
 //-------------------------------------------------------------------------
@@ -47,6 +50,7 @@ struct ImGuiTestEngineResultSummary;// Output of ImGuiTestEngine_GetResultSummar
 struct ImGuiTestItemInfo;           // Info queried from item (id, geometry, status flags, debug label)
 struct ImGuiTestItemList;           // A list of items
 struct ImGuiTestInputs;             // Simulated user inputs (will be fed into ImGuiIO by the test engine)
+struct ImGuiTestInputRecording;     // Inputs submitted by backend, recorded with ImGuiTestEngine_InputRecordBegin() and replayed with ImGuiTestContext::InputReplay()
 struct ImGuiTestRunTask;            // A queued test (test + runflags)
 
 typedef int ImGuiTestFlags;         // Flags: See ImGuiTestFlags_
@@ -160,6 +164,10 @@ struct ImGuiTestEngineResultSummary
     int     CountTested = 0;    // Number of tests executed
     int     CountSuccess = 0;   // Number of tests succeeded
     int     CountInQueue = 0;   // Number of tests remaining in queue (e.g. aborted, crashed)
+    int     ActionCount = 0;    // Number of top-level ctx-> actions spending frames, over all executed tests
+    int     ActionFrames = 0;   // Number of frames spent in those actions
+    int     EngineAllocCount = 0;       // Number of allocator calls made by test engine to setup and teardown tests, over all executed tests
+    int     EngineAllocCountTests = 0;  // Number of executed tests which reported EngineAllocCount
 };
 
 //-------------------------------------------------------------------------
@@ -230,6 +238,12 @@ IMGUI_API void                ImGuiTestEngine_GetTestQueue(ImGuiTestEngine* engi
 static inline void            ImGuiTestEngine_GetResult(ImGuiTestEngine* engine, int& out_count_tested, int& out_count_success) { ImGuiTestEngineResultSummary summary; ImGuiTestEngine_GetResultSummary(engine, &summary); out_count_tested = summary.CountTested; out_count_success = summary.CountSuccess; }
 #endif
 
+// Functions: Input Recording
+// Record inputs submitted by backend (e.g. a real user interaction) into a compact binary log. Replay them in a test with ctx->InputReplay().
+IMGUI_API void                ImGuiTestEngine_InputRecordBegin(ImGuiTestEngine* engine);
+IMGUI_API bool                ImGuiTestEngine_InputRecordEnd(ImGuiTestEngine* engine, const char* filename = IMGUI_TEST_ENGINE_INPUT_RECORDING_DEFAULT_FILENAME); // Stop recording and save to file (unless filename == nullptr).
+IMGUI_API bool                ImGuiTestEngine_IsInputRecording(ImGuiTestEngine* engine);
+
 // Functions: Crash Handling
 // Ensure past test results are properly exported even if application crash during a test.
 IMGUI_API void                ImGuiTestEngine_InstallDefaultCrashHandler();     // Install default crash handler (if you don't have one)
@@ -263,16 +277,26 @@ struct IMGUI_API ImGuiTestEngineIO
     // Options: Main
     bool                        ConfigSavedSettings = true;                     // Load/Save settings in main context .ini file.
     ImGuiTestRunSpeed           ConfigRunSpeed = ImGuiTestRunSpeed_Fast;        // Run tests in fast/normal/cinematic mode
+    bool                        ConfigFastInputCoalescing = false;              // In Fast mode: submit mouse button and key down+up events together and let io.ConfigInputTrickleEventQueue spread them over the minimum number of frames (fewer frames per click/key press). See "frames/action" in results summary.
+    int                         ConfigKeyCharsPerFrame = 0;                     // In Fast mode: characters submitted per frame by KeyChars() and KeyCharsXXX() functions (0: all at once). Characters are decoded once and queued as a single batch.
     bool                        ConfigStopOnError = false;                      // Stop queued tests on test error
     bool                        ConfigBreakOnError = false;                     // Break debugger on test error by calling IM_DEBUG_BREAK()
     bool                        ConfigKeepGuiFunc = false;                      // Keep test GUI running at the end of the test
     bool                        ConfigRestoreFocusAfterTests = true;// Restore focus back after running tests
+    bool                        ConfigItemGraph = false;            // Maintain a graph of all submitted items (ID -> parent, depth, window, status, last seen frame) from hooks, so GatherItems()/ItemActionAll() are answered without yielding and later ItemActionAll() passes don't click items again. Enables item hooks on every frame.
+    bool                        ConfigRestoreUiStateBetweenTests = false; // Snapshot windows (pos/size/collapsed/scroll/docking), settings, tables and dock nodes when starting a batch (or first test run after setting this), restore them in memory before each test and after the batch.
+    bool                        ConfigForkIsolation = false;        // [Linux] Run each queued test (excluding perf tests) in a fork() of the warmed-up process, getting its output back over a pipe. A crash or hang only fails that test, and global state doesn't leak between tests. Applies to tests queued before a frame (e.g. from command-line). Requires a headless app (no platform backend, e.g. Null backend). Children run one at a time without blocking parent frames, and are killed if silent for longer than ConfigWatchdogKillTest (x10 when not in Fast mode) + 5 seconds.
     bool                        ConfigCaptureEnabled = true;        // Master enable flags for capturing and saving captures. Disable to avoid e.g. lengthy saving of large PNG files.
     bool                        ConfigCaptureOnError = false;
     bool                        ConfigNoThrottle = false;           // Disable vsync for performance measurement or fast test running
     bool                        ConfigMouseDrawCursor = true;       // Enable drawing of Dear ImGui software mouse cursor when running tests
     float                       ConfigFixedDeltaTime = 0.0f;        // Use fixed delta time instead of calculating it from wall clock
+    bool                        ConfigVirtualTime = false;          // While running tests: drive io.DeltaTime from a simulated clock (ConfigVirtualTimeStep per frame) and request max app speed. Normal/Cinematic runs and video captures are produced as fast as possible and are reproducible.
+    float                       ConfigVirtualTimeStep = 1.0f / 60.0f; // Simulated delta time per frame when ConfigVirtualTime is enabled.
     int                         PerfStressAmount = 1;               // Integer to scale the amount of items submitted in test
+    int                         PerfStressSweepSteps = 0;           // When >= 2: run each perf test (ImGuiTestGroup_Perfs) this many times with PerfStressAmount << n (fewer steps if that would overflow an int), then fit scaling of results (cost per stress unit, complexity exponent) in PerfCapture(). Slow!
+    bool                        ConfigPerfCounters = false;         // Capture hardware performance counters (instructions, cycles, cache misses, branch misses) in PerfCapture(). Linux only, ignored when unavailable.
+    bool                        ConfigPerfCpuTime = false;          // Measure main thread CPU time of NewFrame->Render (UI build) and Render->PreSwap phases in PerfCapture(). Requires PreSwap()/PostSwap() hooks to be called by the app.
     char                        GitBranchName[64] = "";             // e.g. fill in branch name (e.g. recorded in perf samples .csv)
 
     // Options: Logging
@@ -307,6 +331,7 @@ struct IMGUI_API ImGuiTestEngineIO
     // While you can manually call ImGuiTestEngine_Export(), registering filename/format here ensure the crash handler will always export if application crash.
     const char*                 ExportResultsFilename = nullptr;
     ImGuiTestEngineExportFormat ExportResultsFormat = (ImGuiTestEngineExportFormat)0;
+    int                         ExportResultsThreads = 0;           // Threads formatting per-test fragments of exported results (0: auto). Requires IMGUI_TEST_ENGINE_ENABLE_EXPORT_THREADS, otherwise always 1.
 
     // Options: Sanity Checks
     bool                        CheckDrawDataIntegrity = false;     // Check ImDrawData integrity (buffer count, etc.). Currently cheap but may become a slow operation.
@@ -371,13 +396,28 @@ struct IMGUI_API ImGuiTestLogLineInfo
 {
     ImGuiTestVerboseLevel           Level;
     int                             LineOffset;
+    int                             LineLength;     // Excluding trailing '\n'
+};
+
+// Number of lines per verbose level before a block of IMGUI_TEST_LOG_LINES_PER_BLOCK lines.
+// Allows seeking to the Nth line of a verbose level filtered view without scanning from the start.
+#define IMGUI_TEST_LOG_LINES_PER_BLOCK  64
+
+// Number of ImU64 in the search signature of a line: 128 bits, one bit set per hashed trigram of the line.
+#define IMGUI_TEST_LOG_SEARCH_SIGNATURE_SIZE    2
+struct IMGUI_API ImGuiTestLogLineBlock
+{
+    int                             CountPerLevel[ImGuiTestVerboseLevel_COUNT];
 };
 
 struct IMGUI_API ImGuiTestLog
 {
     ImGuiTextBuffer                 Buffer;
     ImVector<ImGuiTestLogLineInfo>  LineInfo;
+    ImVector<ImGuiTestLogLineBlock> LineBlocks;     // One entry every IMGUI_TEST_LOG_LINES_PER_BLOCK lines
     int                             CountPerLevel[ImGuiTestVerboseLevel_COUNT] = {};
+    ImVector<ImU64>                 SearchIndex;    // Case-insensitive trigram signature of each line for Search(), IMGUI_TEST_LOG_SEARCH_SIGNATURE_SIZE entries per line. Built on first Search().
+    int                             SearchIndexLines = 0;       // Number of lines in SearchIndex
 
     // Functions
     ImGuiTestLog() {}
@@ -397,6 +437,18 @@ struct IMGUI_API ImGuiTestLog
     // - To get All Errors, Warnings, Debug...  Use level_min == ImGuiTestVerboseLevel_Error, level_max = ImGuiTestVerboseLevel_Trace
     int     ExtractLinesForVerboseLevels(ImGuiTestVerboseLevel level_min, ImGuiTestVerboseLevel level_max, ImGuiTextBuffer* out_buffer);
 
+    // Find index into LineInfo[] of the Nth line (0-based) within given verbose levels (inclusive). Return -1 if out of range.
+    // This is O(log N) + scanning at most IMGUI_TEST_LOG_LINES_PER_BLOCK lines.
+    int     FindLineIndexForVerboseLevels(ImGuiTestVerboseLevel level_min, ImGuiTestVerboseLevel level_max, int filtered_line_no);
+
+    // Full-text search (case-insensitive). Output indices into LineInfo[] of matching lines, in ascending order. Return number of matches.
+    // Queries of 3 characters and more only verify lines whose trigram signature matches the query's. Signatures of lines added
+    // since last call are computed on demand, so logs which are never searched have no index.
+    int     Search(const char* query, ImVector<int>* out_lines);
+    void    UpdateSearchIndex();
+    const char* GetLineBegin(int line_idx)  { return Buffer.c_str() + LineInfo[line_idx].LineOffset; }
+    const char* GetLineEnd(int line_idx)    { return Buffer.c_str() + LineInfo[line_idx].LineOffset + LineInfo[line_idx].LineLength; }
+
     // [Internal]
     void    UpdateLineOffsets(ImGuiTestEngineIO* engine_io, ImGuiTestVerboseLevel level, const char* start);
 };
@@ -414,12 +466,26 @@ typedef void    (ImGuiTestVarsPostConstructor)(ImGuiTestContext* ctx, void* ptr,
 typedef void    (ImGuiTestVarsDestructor)(void* ptr);
 
 // Storage for the output of a test run
+// Frames and wall time consumed by calls to one ImGuiTestContext function (see ImGuiTestOutput::ActionStats)
+struct ImGuiTestActionStats
+{
+    const char*                     Name = nullptr;                 // Function name (literal)
+    int                             Calls = 0;
+    int                             Frames = 0;                     // Frames elapsed during calls, including nested calls
+    ImU64                           TimeUs = 0;                     // Wall time elapsed during calls, including nested calls
+};
+
 struct IMGUI_API ImGuiTestOutput
 {
     ImGuiTestStatus                 Status = ImGuiTestStatus_Unknown;
     ImGuiTestLog                    Log;
     ImU64                           StartTime = 0;
     ImU64                           EndTime = 0;
+    int                             ActionCount = 0;                // Number of top-level ctx-> actions which spent at least one frame (e.g. ItemClick(), KeyPress())
+    int                             ActionFrames = 0;               // Number of frames spent in those actions
+    ImVector<ImGuiTestActionStats>  ActionStats;                    // Per ctx-> function accounting of TestFunc, at all nesting levels (see ImGuiTestEngine_PrintResultSummary())
+    ImGuiStorage                    ActionStatsLookup;              // [Internal] Hash of function name -> index into ActionStats
+    int                             EngineAllocCount = -1;          // Number of allocator calls made by test engine to setup and teardown the test and to append to its log (-1 if unavailable: requires Dear ImGui 1.90+)
 };
 
 // Storage for one test
@@ -483,6 +549,56 @@ struct IMGUI_API ImGuiTestRunTask
     ImGuiTestRunFlags   RunFlags = ImGuiTestRunFlags_None;
 };
 
+//-------------------------------------------------------------------------
+// ImGuiTestInputRecording
+//-------------------------------------------------------------------------
+
+// Inputs submitted by backend, delta-encoded into a compact byte stream with frame stamps.
+// Each frame with events is stored as: [frames elapsed since last record] [elapsed time in microseconds] [event count] [events...]
+// Each event is a type byte followed by varint-encoded payload. Mouse positions are stored as deltas in 1/16th of pixels.
+// Focus and mouse viewport events are not recorded.
+// Replaying a recording as a test:
+//   ImGuiTest* t = IM_REGISTER_TEST(e, "replays", "bug_1234");
+//   t->TestFunc = [](ImGuiTestContext* ctx) { ctx->InputReplay("recordings/bug_1234.bin"); };
+struct IMGUI_API ImGuiTestInputRecording
+{
+    ImVector<unsigned char>     Data;                           // Encoded stream (file contents, without header)
+    int                         FrameCount = 0;                 // Number of frames covered by recording
+    int                         EventCount = 0;                 // Number of events recorded
+
+    // [Internal] Encoder state
+    ImVector<unsigned char>     _FrameData;                     // Events of current frame
+    int                         _FrameEventCount = 0;
+    int                         _PendingFrames = 0;             // Frames elapsed since last record
+    double                      _PendingTime = 0.0;             // Time elapsed since last record
+    int                         _MouseX = 0;                    // Last mouse position, in 1/16th of pixels
+    int                         _MouseY = 0;
+
+    void        Clear();
+    void        AddFrame(float delta_time);                     // Call once at the beginning of each recorded frame.
+    void        AddEvent(const ImGuiInputEvent* e);             // Record event for current frame.
+    void        Finish();                                       // Flush pending frames. Called by SaveToFile().
+    bool        SaveToFile(const char* filename);
+    bool        LoadFromFile(const char* filename);
+};
+
+// Decoding state for ImGuiTestInputRecording, see ImGuiTestInputRecordingReader::ReadFrame()
+struct IMGUI_API ImGuiTestInputRecordingReader
+{
+    const ImGuiTestInputRecording* Recording = nullptr;
+    int                         Offset = 0;                     // Read offset in Recording->Data
+    int                         MouseX = 0;                     // Last mouse position, in 1/16th of pixels
+    int                         MouseY = 0;
+
+    // Output of last ReadFrame() call
+    int                         FrameCount = 0;                 // Frames elapsed since previous record. Events apply to the last one.
+    float                       DeltaTime = 0.0f;               // Time elapsed over those frames.
+    ImVector<ImGuiInputEvent>   Events;
+
+    ImGuiTestInputRecordingReader(const ImGuiTestInputRecording* recording) { Recording = recording; }
+    bool        ReadFrame();                                    // Return false when reaching end of stream (or on corrupted data).
+};
+
 //-------------------------------------------------------------------------
 
 #if defined(__clang__)
@@ -12,6 +12,20 @@
 #include "imgui_te_engine.h"
 #include "imgui_te_internal.h"
 #include "thirdparty/Str/Str.h"
+#if IMGUI_TEST_ENGINE_ENABLE_EXPORT_THREADS
+#include <atomic>
+#include <thread>
+#endif
+#if (defined(__linux) || defined(__linux__) || defined(__APPLE__)) && !IMGUI_TEST_ENGINE_IS_GAME_CONSOLE
+#define IMGUI_TEST_ENGINE_HAS_WRITEV 1
+#include <sys/uio.h>    // writev()
+#include <limits.h>     // IOV_MAX
+#include <unistd.h>
+#include <errno.h>
+#endif
+#ifndef IMGUI_TEST_ENGINE_HAS_WRITEV
+#define IMGUI_TEST_ENGINE_HAS_WRITEV 0
+#endif
 
 // Warnings
 #if defined(__clang__)
@@ -28,11 +42,13 @@
 //-------------------------------------------------------------------------
 
 static void ImGuiTestEngine_ExportJUnitXml(ImGuiTestEngine* engine, const char* output_file);
+static void ImGuiTestEngine_PrintActionStats(ImGuiTestEngine* engine, ImGuiTextBuffer* buf, int indent, int group);
 
 //-------------------------------------------------------------------------
 // [SECTION] TEST ENGINE EXPORTER FUNCTIONS
 //-------------------------------------------------------------------------
 // - ImGuiTestEngine_PrintResultSummary()
+// - ImGuiTestEngine_PrintActionStats() [Internal]
 // - ImGuiTestEngine_Export()
 // - ImGuiTestEngine_ExportEx()
 // - ImGuiTestEngine_ExportJUnitXml()
@@ -57,11 +73,108 @@ void ImGuiTestEngine_PrintResultSummary(ImGuiTestEngine* engine)
     printf("(%d/%d tests passed)\n", summary.CountSuccess, summary.CountTested);
     if (summary.CountInQueue > 0)
         printf("(%d queued tests remaining)\n", summary.CountInQueue);
+    if (summary.ActionCount > 0)
+        printf("(%d actions in %d frames, %.2f frames/action)\n", summary.ActionCount, summary.ActionFrames, (double)summary.ActionFrames / summary.ActionCount);
+    if (summary.EngineAllocCountTests > 0)
+        printf("(%.1f test engine allocations per test)\n", (double)summary.EngineAllocCount / summary.EngineAllocCountTests);
+    if (engine->ExportThreadsCount > 0)
+        printf("(results exported in %.1f ms, %d thread%s)\n", (double)engine->ExportDurationUs / 1000.0, engine->ExportThreadsCount, engine->ExportThreadsCount > 1 ? "s" : "");
     ImOsConsoleSetTextColor(ImOsConsoleStream_StandardOutput, ImOsConsoleTextColor_White);
+
+    ImGuiTextBuffer action_stats;
+    ImGuiTestEngine_PrintActionStats(engine, &action_stats, 0, -1);
+    fputs(action_stats.c_str(), stdout);
+}
+
+static int IMGUI_CDECL ActionStatsComparerByFrames(const void* lhs, const void* rhs)
+{
+    const ImGuiTestActionStats* a = (const ImGuiTestActionStats*)lhs;
+    const ImGuiTestActionStats* b = (const ImGuiTestActionStats*)rhs;
+    if (a->Frames != b->Frames)
+        return (a->Frames > b->Frames) ? -1 : +1;
+    return (a->TimeUs > b->TimeUs) ? -1 : (a->TimeUs < b->TimeUs) ? +1 : 0;
+}
+
+static int IMGUI_CDECL TestComparerByActionFrames(const void* lhs, const void* rhs)
+{
+    const ImGuiTest* a = *(const ImGuiTest* const*)lhs;
+    const ImGuiTest* b = *(const ImGuiTest* const*)rhs;
+    return (a->Output.ActionFrames > b->Output.ActionFrames) ? -1 : (a->Output.ActionFrames < b->Output.ActionFrames) ? +1 : 0;
+}
+
+static const char* GetActionStatsName(const ImGuiTestActionStats* stats)
+{
+    const char* name = stats->Name;
+    if (strncmp(name, "ImGuiTestContext::", 18) == 0) // MSVC's __FUNCTION__ is qualified
+        name += 18;
+    return name;
+}
+
+// Print top-N tables of frames and time spent in ImGuiTestContext functions (aggregated over executed tests), and of tests spending most frames in actions.
+// This helps finding tests wasting frames (e.g. on ItemInfo() retries, scrolling) rather than on their GuiFunc cost.
+// Pass group == -1 to include all groups.
+static void ImGuiTestEngine_PrintActionStats(ImGuiTestEngine* engine, ImGuiTextBuffer* buf, int indent, int group)
+{
+    const int TOP_N = 10;
+
+    ImVector<ImGuiTestActionStats> all_stats;
+    ImGuiStorage all_stats_lookup; // Function name -> index into all_stats
+    ImVector<ImGuiTest*> tests;
+    for (ImGuiTest* test : engine->TestsAll)
+    {
+        if (group != -1 && test->Group != group)
+            continue;
+        if (test->Output.Status == ImGuiTestStatus_Unknown || test->Output.Status == ImGuiTestStatus_Queued)
+            continue;
+        if (test->Output.ActionFrames > 0)
+            tests.push_back(test);
+        for (const ImGuiTestActionStats& stats : test->Output.ActionStats)
+        {
+            const ImGuiID name_key = ImHashStr(stats.Name);
+            const int dst_idx = all_stats_lookup.GetInt(name_key, -1);
+            if (dst_idx == -1)
+            {
+                all_stats_lookup.SetInt(name_key, all_stats.Size);
+                all_stats.push_back(stats);
+                continue;
+            }
+            ImGuiTestActionStats* dst = &all_stats[dst_idx];
+            dst->Calls += stats.Calls;
+            dst->Frames += stats.Frames;
+            dst->TimeUs += stats.TimeUs;
+        }
+    }
+    if (all_stats.Size == 0)
+        return;
+
+    ImQsort(all_stats.Data, (size_t)all_stats.Size, sizeof(ImGuiTestActionStats), ActionStatsComparerByFrames);
+    buf->appendf("\n%*sTop %d context functions by frames (including nested calls):\n", indent, "", ImMin(TOP_N, all_stats.Size));
+    buf->appendf("%*s%8s %11s %8s  %s\n", indent, "", "Frames", "Time (ms)", "Calls", "Function");
+    for (int n = 0; n < all_stats.Size && n < TOP_N; n++)
+    {
+        const ImGuiTestActionStats* stats = &all_stats[n];
+        buf->appendf("%*s%8d %11.1f %8d  %s\n", indent, "", stats->Frames, (double)stats->TimeUs / 1000.0, stats->Calls, GetActionStatsName(stats));
+    }
+
+    if (tests.Size == 0)
+        return;
+    ImQsort(tests.Data, (size_t)tests.Size, sizeof(ImGuiTest*), TestComparerByActionFrames);
+    buf->appendf("\n%*sTop %d tests by frames spent in actions:\n", indent, "", ImMin(TOP_N, tests.Size));
+    buf->appendf("%*s%8s %11s %8s  %s\n", indent, "", "Frames", "Time (ms)", "Actions", "Test (most frames in)");
+    for (int n = 0; n < tests.Size && n < TOP_N; n++)
+    {
+        const ImGuiTestOutput* output = &tests[n]->Output;
+        const ImGuiTestActionStats* worst = nullptr;
+        for (const ImGuiTestActionStats& stats : output->ActionStats)
+            if (worst == nullptr || stats.Frames > worst->Frames)
+                worst = &stats;
+        buf->appendf("%*s%8d %11.1f %8d  %s (%s: %d frames)\n", indent, "", output->ActionFrames, (double)(output->EndTime - output->StartTime) / 1000.0, output->ActionCount,
+            tests[n]->Name, worst ? GetActionStatsName(worst) : "", worst ? worst->Frames : 0);
+    }
 }
 
 // This is mostly a copy of ImGuiTestEngine_PrintResultSummary with few additions.
-static void ImGuiTestEngine_ExportResultSummary(ImGuiTestEngine* engine, FILE* fp, int indent_count, ImGuiTestGroup group)
+static void ImGuiTestEngine_ExportResultSummary(ImGuiTestEngine* engine, ImGuiTextBuffer* buf, int indent_count, ImGuiTestGroup group)
 {
     int count_tested = 0;
     int count_success = 0;
@@ -84,43 +197,102 @@ static void ImGuiTestEngine_ExportResultSummary(ImGuiTestEngine* engine, FILE* f
 
     if (count_success < count_tested)
     {
-        fprintf(fp, "\n%sFailing tests:\n", indent);
+        buf->appendf("\n%sFailing tests:\n", indent);
         for (ImGuiTest* test : engine->TestsAll)
         {
             if (test->Group != group)
                 continue;
             if (test->Output.Status == ImGuiTestStatus_Error)
-                fprintf(fp, "%s- %s\n", indent, test->Name);
+                buf->appendf("%s- %s\n", indent, test->Name);
         }
-        fprintf(fp, "\n");
+        buf->append("\n");
     }
 
-    fprintf(fp, "%sTests Result: %s\n", indent, (count_success == count_tested) ? "OK" : "Errors");
-    fprintf(fp, "%s(%d/%d tests passed)\n", indent, count_success, count_tested);
+    buf->appendf("%sTests Result: %s\n", indent, (count_success == count_tested) ? "OK" : "Errors");
+    buf->appendf("%s(%d/%d tests passed)\n", indent, count_success, count_tested);
 }
 
 static bool ImGuiTestEngine_HasAnyLogLines(ImGuiTestLog* test_log, ImGuiTestVerboseLevel level)
 {
-    for (auto& line_info : test_log->LineInfo)
-        if (line_info.Level <= level)
-            return true;
-    return false;
+    return test_log->ExtractLinesForVerboseLevels(ImGuiTestVerboseLevel_Silent, level, nullptr) > 0;
 }
 
-static void ImGuiTestEngine_PrintLogLines(FILE* fp, ImGuiTestLog* test_log, int indent, ImGuiTestVerboseLevel level)
+// Output of per-test export fragments.
+// - Fragments are formatted twice: first with Buf == nullptr to count bytes, then into storage preallocated with the exact size.
+// - Fragments are formatted by worker threads, which must not allocate (Dear ImGui allocator and its counters are not thread-safe).
+struct ImGuiTestExportWriter
+{
+    char*       Buf = nullptr;
+    int         Size = 0;
+    int         Capacity = 0;       // Excluding the extra byte required by vsnprintf() for its zero-terminator
+
+    void Append(const char* s, const char* s_end)
+    {
+        const int len = (int)(s_end - s);
+        if (Buf != nullptr)
+        {
+            IM_ASSERT(Size + len <= Capacity);
+            memcpy(Buf + Size, s, (size_t)len);
+        }
+        Size += len;
+    }
+    void Append(const char* s) { Append(s, s + strlen(s)); }
+
+    void AppendIndent(int count)
+    {
+        if (Buf != nullptr)
+        {
+            IM_ASSERT(Size + count <= Capacity);
+            memset(Buf + Size, ' ', (size_t)count);
+        }
+        Size += count;
+    }
+
+    void Appendf(const char* fmt, ...) IM_FMTARGS(2)
+    {
+        va_list args;
+        va_start(args, fmt);
+        const int len = vsnprintf(Buf ? Buf + Size : nullptr, Buf ? (size_t)(Capacity - Size + 1) : 0, fmt, args);
+        va_end(args);
+        IM_ASSERT(len >= 0 && (Buf == nullptr || Size + len <= Capacity));
+        Size += len;
+    }
+
+    // Same output as ImStrXmlEscape()
+    void AppendXmlEscaped(const char* s, const char* s_end)
+    {
+        const char* run_begin = s;
+        for (; s < s_end; s++)
+        {
+            const char* escaped;
+            switch (*s)
+            {
+            case '&':   escaped = "&amp;"; break;
+            case '<':   escaped = "&lt;"; break;
+            case '>':   escaped = "&gt;"; break;
+            case '\"':  escaped = "&quot;"; break;
+            case '\'':  escaped = "&apos;"; break;
+            default:    continue;
+            }
+            Append(run_begin, s);
+            Append(escaped);
+            run_begin = s + 1;
+        }
+        Append(run_begin, s_end);
+    }
+};
+
+static void ImGuiTestEngine_PrintLogLines(ImGuiTestExportWriter* w, ImGuiTestLog* test_log, int indent, ImGuiTestVerboseLevel level)
 {
-    Str128 log_line;
-    for (auto& line_info : test_log->LineInfo)
+    for (int line_idx = 0; line_idx < test_log->LineInfo.Size; line_idx++)
     {
-        if (line_info.Level > level)
+        if (test_log->LineInfo[line_idx].Level > level)
             continue;
-        const char* line_start = test_log->Buffer.c_str() + line_info.LineOffset;
-        const char* line_end = strstr(line_start, "\n"); // FIXME: Incorrect.
-        log_line.set(line_start, line_end);
-        ImStrXmlEscape(&log_line); // FIXME: Should not be here considering the function name.
 
         // Some users may want to disable indenting?
-        fprintf(fp, "%*s%s\n", indent, "", log_line.c_str());
+        w->AppendIndent(indent);
+        w->AppendXmlEscaped(test_log->GetLineBegin(line_idx), test_log->GetLineEnd(line_idx));
+        w->Append("\n");
     }
 }
 
@@ -145,11 +317,197 @@ void ImGuiTestEngine_ExportEx(ImGuiTestEngine* engine, ImGuiTestEngineExportForm
         IM_ASSERT(0);
 }
 
+// Call func(n) for n in [0, count), spread over 'threads_count' threads (including calling thread).
+template<typename FUNC>
+static void ImGuiTestEngine_ExportParallelFor(int threads_count, int count, const FUNC& func)
+{
+#if IMGUI_TEST_ENGINE_ENABLE_EXPORT_THREADS
+    if (threads_count > 1)
+    {
+        std::atomic<int> next_n(0);
+        auto worker = [&]()
+        {
+            for (int n = next_n.fetch_add(1); n < count; n = next_n.fetch_add(1))
+                func(n);
+        };
+        ImVector<std::thread*> threads;
+        for (int thread_n = 1; thread_n < threads_count; thread_n++)
+            threads.push_back(IM_NEW(std::thread)(worker));
+        worker();
+        for (std::thread* thread : threads)
+        {
+            thread->join();
+            IM_DELETE(thread);
+        }
+        return;
+    }
+#else
+    IM_UNUSED(threads_count);
+#endif
+    for (int n = 0; n < count; n++)
+        func(n);
+}
+
+struct ImGuiTestExportChunk
+{
+    const char* Data;           // nullptr: refer to TextOffset in per-testsuite text while it is being built
+    int         TextOffset;
+    int         Size;
+};
+
+// Write chunks of data to a file, with as few system calls as possible.
+
+static bool ImGuiTestEngine_ExportWriteChunks(FILE* fp, const ImVector<ImGuiTestExportChunk>& chunks)
+{
+#if IMGUI_TEST_ENGINE_HAS_WRITEV
+    // Vectored writes, IOV_MAX chunks at a time
+    fflush(fp);
+    const int fd = fileno(fp);
+#ifdef IOV_MAX
+    struct iovec iov[IOV_MAX < 1024 ? IOV_MAX : 1024];
+#else
+    struct iovec iov[16];
+#endif
+    const int iov_max = IM_COUNTOF(iov);
+    for (int chunk_n = 0; chunk_n < chunks.Size; )
+    {
+        int iov_count = 0;
+        for (; chunk_n < chunks.Size && iov_count < iov_max; chunk_n++)
+            if (chunks[chunk_n].Size > 0)
+            {
+                iov[iov_count].iov_base = (void*)chunks[chunk_n].Data;
+                iov[iov_count].iov_len = (size_t)chunks[chunk_n].Size;
+                iov_count++;
+            }
+
+        // Handle partial writes by advancing through the iovec array
+        struct iovec* iov_curr = iov;
+        while (iov_count > 0)
+        {
+            ssize_t written = writev(fd, iov_curr, iov_count);
+            if (written < 0)
+            {
+                if (errno == EINTR)
+                    continue;
+                return false;
+            }
+            while (iov_count > 0 && (size_t)written >= iov_curr->iov_len)
+            {
+                written -= (ssize_t)iov_curr->iov_len;
+                iov_curr++;
+                iov_count--;
+            }
+            if (iov_count > 0)
+            {
+                iov_curr->iov_base = (char*)iov_curr->iov_base + written;
+                iov_curr->iov_len -= (size_t)written;
+            }
+        }
+    }
+    return true;
+#else
+    for (const ImGuiTestExportChunk& chunk : chunks)
+        if (chunk.Size > 0 && fwrite(chunk.Data, 1, (size_t)chunk.Size, fp) != (size_t)chunk.Size)
+            return false;
+    return true;
+#endif
+}
+
+enum ImGuiTestExportJUnitFragment
+{
+    ImGuiTestExportJUnitFragment_TestCase,      // <testcase> element
+    ImGuiTestExportJUnitFragment_SystemOut,     // Test log in <system-out> element of <testsuite>
+    ImGuiTestExportJUnitFragment_SystemErr,     // Test warnings and errors in <system-err> element of <testsuite>
+    ImGuiTestExportJUnitFragment_COUNT
+};
+
+// Format one per-test fragment of JUnit XML output.
+// This may be called from worker threads: it should only read from engine and test.
+static void ImGuiTestEngine_ExportJUnitXmlFragment(ImGuiTestEngine* engine, ImGuiTest* test, ImGuiTestExportJUnitFragment fragment, ImGuiTestExportWriter* w)
+{
+    ImGuiTestOutput* test_output = &test->Output;
+    ImGuiTestLog* test_log = &test_output->Log;
+
+    if (fragment == ImGuiTestExportJUnitFragment_TestCase)
+    {
+        // Attributes for <testcase> tag.
+        const char* testcase_name = test->Name;
+        const char* testcase_classname = test->Category;
+        const char* testcase_status = ImGuiTestEngine_GetStatusName(test_output->Status);
+        const float testcase_time = (float)((double)(test_output->EndTime - test_output->StartTime) / 1000000.0);
+
+        w->Appendf("    <testcase name=\"%s\" assertions=\"0\" classname=\"%s\" status=\"%s\" time=\"%.3f\">\n",
+            testcase_name, testcase_classname, testcase_status, testcase_time);
+
+        if (test_output->Status == ImGuiTestStatus_Error)
+        {
+            // Skip last error message because it is generic information that test failed.
+            int error_line_idx = -1;
+            for (int i = test_log->LineInfo.Size - 2; i >= 0; i--)
+            {
+                ImGuiTestLogLineInfo* line_info = &test_log->LineInfo[i];
+                if (line_info->Level > engine->IO.ConfigVerboseLevelOnError)
+                    continue;
+                if (line_info->Level == ImGuiTestVerboseLevel_Error)
+                {
+                    error_line_idx = i;
+                    break;
+                }
+            }
+
+            // Failing tests save their "on error" log output in text element of <failure> tag.
+            w->Append("      <failure message=\"");
+            if (error_line_idx != -1)
+                w->AppendXmlEscaped(test_log->GetLineBegin(error_line_idx), test_log->GetLineEnd(error_line_idx));
+            w->Append("\" type=\"error\">\n");
+            ImGuiTestEngine_PrintLogLines(w, test_log, 8, engine->IO.ConfigVerboseLevelOnError);
+            w->Append("      </failure>\n");
+        }
+
+        if (test_output->Status == ImGuiTestStatus_Unknown)
+        {
+            w->Append("      <skipped message=\"Skipped\" />\n");
+        }
+        else
+        {
+            // Succeeding tests save their default log output output as "stdout".
+            if (ImGuiTestEngine_HasAnyLogLines(test_log, engine->IO.ConfigVerboseLevel))
+            {
+                w->Append("      <system-out>\n");
+                ImGuiTestEngine_PrintLogLines(w, test_log, 8, engine->IO.ConfigVerboseLevel);
+                w->Append("      </system-out>\n");
+            }
+
+            // Save error messages as "stderr".
+            if (ImGuiTestEngine_HasAnyLogLines(test_log, ImGuiTestVerboseLevel_Error))
+            {
+                w->Append("      <system-err>\n");
+                ImGuiTestEngine_PrintLogLines(w, test_log, 8, ImGuiTestVerboseLevel_Error);
+                w->Append("      </system-err>\n");
+            }
+        }
+        w->Append("    </testcase>\n");
+        return;
+    }
+
+    // Log all log messages as "stdout", all warning and error messages as "stderr".
+    if (test_output->Status == ImGuiTestStatus_Unknown)
+        return;
+    w->Appendf("      [0000] Test: '%s' '%s'..\n", test->Category, test->Name);
+    if (fragment == ImGuiTestExportJUnitFragment_SystemOut)
+        ImGuiTestEngine_PrintLogLines(w, test_log, 6, test_output->Status == ImGuiTestStatus_Error ? engine->IO.ConfigVerboseLevelOnError : engine->IO.ConfigVerboseLevel);
+    else
+        ImGuiTestEngine_PrintLogLines(w, test_log, 6, ImGuiTestVerboseLevel_Warning);
+}
+
+// Per-test fragments are formatted in parallel into a single preallocated storage, then written along with
+// per-testsuite text using vectored writes.
 void ImGuiTestEngine_ExportJUnitXml(ImGuiTestEngine* engine, const char* output_file)
 {
     IM_ASSERT(engine != nullptr);
     IM_ASSERT(output_file != nullptr);
 
+    const ImU64 export_start_time = ImTimeGetInMicroseconds();
     FILE* fp = fopen(output_file, "w+b");
     if (fp == nullptr)
     {
@@ -179,6 +537,59 @@ void ImGuiTestEngine_ExportJUnitXml(ImGuiTestEngine* engine, const char* output_
             stats->Disabled += 1;
     }
 
+    // Format per-test fragments: count bytes, allocate storage, then write into it.
+    // Each fragment is followed by an extra byte for vsnprintf() zero-terminator, so threads never write into a neighbor fragment.
+    int threads_count = 1;
+#if IMGUI_TEST_ENGINE_ENABLE_EXPORT_THREADS
+    const int THREADS_MAX = 16;
+    const int TESTS_PER_THREAD_MIN = 32;
+    threads_count = (engine->IO.ExportResultsThreads > 0) ? engine->IO.ExportResultsThreads : (int)std::thread::hardware_concurrency();
+    threads_count = ImClamp(ImMin(threads_count, engine->TestsAll.Size / TESTS_PER_THREAD_MIN), 1, THREADS_MAX);
+#endif
+    const int fragments_count = engine->TestsAll.Size * ImGuiTestExportJUnitFragment_COUNT;
+    ImVector<ImGuiTestExportWriter> fragments;
+    fragments.resize(fragments_count, ImGuiTestExportWriter());
+    ImGuiTestEngine_ExportParallelFor(threads_count, fragments_count, [&](int n)
+    {
+        ImGuiTestExportWriter* w = &fragments[n];
+        ImGuiTestEngine_ExportJUnitXmlFragment(engine, engine->TestsAll[n / ImGuiTestExportJUnitFragment_COUNT], (ImGuiTestExportJUnitFragment)(n % ImGuiTestExportJUnitFragment_COUNT), w);
+        w->Capacity = w->Size;
+        w->Size = 0;
+    });
+    size_t storage_size = 0;
+    for (ImGuiTestExportWriter& w : fragments)
+        storage_size += (size_t)w.Capacity + 1;
+    char* storage = (char*)IM_ALLOC(storage_size > 0 ? storage_size : 1);
+    size_t storage_offset = 0;
+    for (ImGuiTestExportWriter& w : fragments)
+    {
+        w.Buf = storage + storage_offset;
+        storage_offset += (size_t)w.Capacity + 1;
+    }
+    ImGuiTestEngine_ExportParallelFor(threads_count, fragments_count, [&](int n)
+    {
+        ImGuiTestExportWriter* w = &fragments[n];
+        ImGuiTestEngine_ExportJUnitXmlFragment(engine, engine->TestsAll[n / ImGuiTestExportJUnitFragment_COUNT], (ImGuiTestExportJUnitFragment)(n % ImGuiTestExportJUnitFragment_COUNT), w);
+        IM_ASSERT(w->Size == w->Capacity);
+    });
+
+    // Per-testsuite text is appended to a single buffer, chunks store offsets into it until it stops growing.
+    ImGuiTextBuffer text;
+    ImVector<ImGuiTestExportChunk> chunks;
+    int text_offset = 0;
+    auto add_text_chunk = [&]()
+    {
+        ImGuiTestExportChunk chunk = { nullptr, text_offset, text.size() - text_offset };
+        chunks.push_back(chunk);
+        text_offset = text.size();
+    };
+    auto add_fragment_chunk = [&](int test_n, ImGuiTestExportJUnitFragment fragment)
+    {
+        const ImGuiTestExportWriter& w = fragments[test_n * ImGuiTestExportJUnitFragment_COUNT + fragment];
+        ImGuiTestExportChunk chunk = { w.Buf, 0, w.Size };
+        chunks.push_back(chunk);
+    };
+
     // Attributes for <testsuites> tag.
     const char* testsuites_name = "Dear ImGui";
     int testsuites_failures = 0;
@@ -193,7 +604,7 @@ void ImGuiTestEngine_ExportJUnitXml(ImGuiTestEngine* engine, const char* output_
     }
 
     // FIXME: "errors" attribute and <error> tag in <testcase> may be supported if we have means to catch unexpected errors like assertions.
-    fprintf(fp, "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+    text.appendf("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
         "<testsuites disabled=\"%d\" errors=\"0\" failures=\"%d\" name=\"%s\" tests=\"%d\" time=\"%.3f\">\n",
         testsuites_disabled, testsuites_failures, testsuites_name, testsuites_tests, testsuites_time);
 
@@ -204,115 +615,53 @@ void ImGuiTestEngine_ExportJUnitXml(ImGuiTestEngine* engine, const char* output_
         float testsuite_time = testsuites_time;         // FIXME: We do not differentiate between tests and perfs, they are executed in one big batch.
         Str30 testsuite_timestamp = "";
         ImTimestampToISO8601(engine->BatchStartTime, &testsuite_timestamp);
-        fprintf(fp, "  <testsuite name=\"%s\" tests=\"%d\" disabled=\"%d\" errors=\"0\" failures=\"%d\" hostname=\"\" id=\"%d\" package=\"\" skipped=\"0\" time=\"%.3f\" timestamp=\"%s\">\n",
+        text.appendf("  <testsuite name=\"%s\" tests=\"%d\" disabled=\"%d\" errors=\"0\" failures=\"%d\" hostname=\"\" id=\"%d\" package=\"\" skipped=\"0\" time=\"%.3f\" timestamp=\"%s\">\n",
             testsuite->Name, testsuite->Tests, testsuite->Disabled, testsuite->Failures, testsuite_id, testsuite_time, testsuite_timestamp.c_str());
+        add_text_chunk();
 
         for (int n = 0; n < engine->TestsAll.Size; n++)
-        {
-            ImGuiTest* test = engine->TestsAll[n];
-            if (test->Group != testsuite_id)
-                continue;
-
-            ImGuiTestOutput* test_output = &test->Output;
-            ImGuiTestLog* test_log = &test_output->Log;
-
-            // Attributes for <testcase> tag.
-            const char* testcase_name = test->Name;
-            const char* testcase_classname = test->Category;
-            const char* testcase_status = ImGuiTestEngine_GetStatusName(test_output->Status);
-            const float testcase_time = (float)((double)(test_output->EndTime - test_output->StartTime) / 1000000.0);
-
-            fprintf(fp, "    <testcase name=\"%s\" assertions=\"0\" classname=\"%s\" status=\"%s\" time=\"%.3f\">\n",
-                testcase_name, testcase_classname, testcase_status, testcase_time);
-
-            if (test_output->Status == ImGuiTestStatus_Error)
-            {
-                // Skip last error message because it is generic information that test failed.
-                Str128 log_line;
-                for (int i = test_log->LineInfo.Size - 2; i >= 0; i--)
-                {
-                    ImGuiTestLogLineInfo* line_info = &test_log->LineInfo[i];
-                    if (line_info->Level > engine->IO.ConfigVerboseLevelOnError)
-                        continue;
-                    if (line_info->Level == ImGuiTestVerboseLevel_Error)
-                    {
-                        const char* line_start = test_log->Buffer.c_str() + line_info->LineOffset;
-                        const char* line_end = strstr(line_start, "\n");
-                        log_line.set(line_start, line_end);
-                        ImStrXmlEscape(&log_line);
-                        break;
-                    }
-                }
-
-                // Failing tests save their "on error" log output in text element of <failure> tag.
-                fprintf(fp, "      <failure message=\"%s\" type=\"error\">\n", log_line.c_str());
-                ImGuiTestEngine_PrintLogLines(fp, test_log, 8, engine->IO.ConfigVerboseLevelOnError);
-                fprintf(fp, "      </failure>\n");
-            }
-
-            if (test_output->Status == ImGuiTestStatus_Unknown)
-            {
-                fprintf(fp, "      <skipped message=\"Skipped\" />\n");
-            }
-            else
-            {
-                // Succeeding tests save their default log output output as "stdout".
-                if (ImGuiTestEngine_HasAnyLogLines(test_log, engine->IO.ConfigVerboseLevel))
-                {
-                    fprintf(fp, "      <system-out>\n");
-                    ImGuiTestEngine_PrintLogLines(fp, test_log, 8, engine->IO.ConfigVerboseLevel);
-                    fprintf(fp, "      </system-out>\n");
-                }
-
-                // Save error messages as "stderr".
-                if (ImGuiTestEngine_HasAnyLogLines(test_log, ImGuiTestVerboseLevel_Error))
-                {
-                    fprintf(fp, "      <system-err>\n");
-                    ImGuiTestEngine_PrintLogLines(fp, test_log, 8, ImGuiTestVerboseLevel_Error);
-                    fprintf(fp, "      </system-err>\n");
-                }
-            }
-            fprintf(fp, "    </testcase>\n");
-        }
+            if (engine->TestsAll[n]->Group == testsuite_id)
+                add_fragment_chunk(n, ImGuiTestExportJUnitFragment_TestCase);
 
         if (testsuites[testsuite_id].Disabled < testsuites[testsuite_id].Tests) // Any tests executed
         {
             // Log all log messages as "stdout".
-            fprintf(fp, "    <system-out>\n");
+            text.append("    <system-out>\n");
+            add_text_chunk();
             for (int n = 0; n < engine->TestsAll.Size; n++)
-            {
-                ImGuiTest* test = engine->TestsAll[n];
-                ImGuiTestOutput* test_output = &test->Output;
-                if (test->Group != testsuite_id)
-                    continue;
-                if (test_output->Status == ImGuiTestStatus_Unknown)
-                    continue;
-                fprintf(fp, "      [0000] Test: '%s' '%s'..\n", test->Category, test->Name);
-                ImGuiTestVerboseLevel level = test_output->Status == ImGuiTestStatus_Error ? engine->IO.ConfigVerboseLevelOnError : engine->IO.ConfigVerboseLevel;
-                ImGuiTestEngine_PrintLogLines(fp, &test_output->Log, 6, level);
-            }
-            ImGuiTestEngine_ExportResultSummary(engine, fp, 6, (ImGuiTestGroup)testsuite_id);
-            fprintf(fp, "    </system-out>\n");
+                if (engine->TestsAll[n]->Group == testsuite_id)
+                    add_fragment_chunk(n, ImGuiTestExportJUnitFragment_SystemOut);
+            ImGuiTestEngine_ExportResultSummary(engine, &text, 6, (ImGuiTestGroup)testsuite_id);
+            ImGuiTestEngine_PrintActionStats(engine, &text, 6, testsuite_id);
+            text.append("    </system-out>\n");
 
             // Log all warning and error messages as "stderr".
-            fprintf(fp, "    <system-err>\n");
+            text.append("    <system-err>\n");
+            add_text_chunk();
             for (int n = 0; n < engine->TestsAll.Size; n++)
-            {
-                ImGuiTest* test = engine->TestsAll[n];
-                ImGuiTestOutput* test_output = &test->Output;
-                if (test->Group != testsuite_id)
-                    continue;
-                if (test_output->Status == ImGuiTestStatus_Unknown)
-                    continue;
-                fprintf(fp, "      [0000] Test: '%s' '%s'..\n", test->Category, test->Name);
-                ImGuiTestEngine_PrintLogLines(fp, &test_output->Log, 6, ImGuiTestVerboseLevel_Warning);
-            }
-            ImGuiTestEngine_ExportResultSummary(engine, fp, 6, (ImGuiTestGroup)testsuite_id);
-            fprintf(fp, "    </system-err>\n");
+                if (engine->TestsAll[n]->Group == testsuite_id)
+                    add_fragment_chunk(n, ImGuiTestExportJUnitFragment_SystemErr);
+            ImGuiTestEngine_ExportResultSummary(engine, &text, 6, (ImGuiTestGroup)testsuite_id);
+            text.append("    </system-err>\n");
         }
-        fprintf(fp, "  </testsuite>\n");
+        text.append("  </testsuite>\n");
     }
-    fprintf(fp, "</testsuites>\n");
+    text.append("</testsuites>\n");
+    add_text_chunk();
+
+    // Resolve offsets into per-testsuite text, now that it is complete
+    for (ImGuiTestExportChunk& chunk : chunks)
+        if (chunk.Data == nullptr)
+            chunk.Data = text.c_str() + chunk.TextOffset;
+
+    const bool ok = ImGuiTestEngine_ExportWriteChunks(fp, chunks);
     fclose(fp);
-    fprintf(stdout, "Saved test results to '%s' successfully.\n", output_file);
+    IM_FREE(storage);
+
+    engine->ExportDurationUs = ImTimeGetInMicroseconds() - export_start_time;
+    engine->ExportThreadsCount = threads_count;
+    if (!ok)
+        fprintf(stderr, "Writing '%s' failed.\n", output_file);
+    else
+        fprintf(stdout, "Saved test results to '%s' successfully.\n", output_file);
 }
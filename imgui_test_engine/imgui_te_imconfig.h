@@ -28,6 +28,15 @@
 #define IMGUI_TEST_ENGINE_ENABLE_COROUTINE_STDTHREAD_IMPL 0
 #endif
 
+// [Optional, default 0] Use std::thread to format per-test fragments of exported results in parallel (see ImGuiTestEngineIO::ExportResultsThreads)
+#ifndef IMGUI_TEST_ENGINE_ENABLE_EXPORT_THREADS
+#define IMGUI_TEST_ENGINE_ENABLE_EXPORT_THREADS 0
+#endif
+
+// [Optional] Disable SIMD scanning and hardware CRC32C (SSE4.2/ARMv8) in ImHashDecoratedPath().
+// Results are identical either way: this is only provided for debugging and comparing performances.
+//#define IMGUI_TEST_ENGINE_DISABLE_HASH_ACCELERATION
+
 // [Optional, default 0] Disable calls that do not make sense on game consoles
 // (Disable: system(), popen(), sigaction(), colored TTY output)
 #ifndef IMGUI_TEST_ENGINE_IS_GAME_CONSOLE
@@ -34,6 +34,7 @@ struct ImGuiTestInfoTask
 };
 
 // Gather item list in given parent ID.
+// Multiple tasks may be active simultaneously, they are served by a single walk of the ID Stack per submitted item.
 struct ImGuiTestGatherTask
 {
     // Input
@@ -44,8 +45,9 @@ struct ImGuiTestGatherTask
     // Output/Temp
     ImGuiTestItemList*      OutList = nullptr;
     ImGuiTestItemInfo*      LastItemInfo = nullptr;
+    int                     LastItemSerial = -1;            // Value of ImGuiTestEngine::GatherItemSerial when last matched, so an item is added once per task
 
-    void Clear() { memset(this, 0, sizeof(*this)); }
+    void Clear() { memset(this, 0, sizeof(*this)); LastItemSerial = -1; }
 };
 
 // Find item ID given a label and a parent id
@@ -64,11 +66,43 @@ struct ImGuiTestFindByLabelTask
     ImGuiID                 OutItemId = 0;                  // Result item ID
 };
 
+// Persistent graph of items submitted to the UI context (see ImGuiTestEngineIO::ConfigItemGraph)
+// Updated every frame from ItemAdd()/ItemInfo() hooks so GatherItems() can be answered by a lookup instead of yielding.
+// - Items: last known info for each item ID. TimestampMain = last frame the item was submitted.
+// - Links: ID Stack entry -> parent ID Stack entry (crossing child windows boundaries), used to compute depth from any parent.
+struct ImGuiTestItemGraphItem
+{
+    ImGuiTestItemInfo       Info;
+    int                     SubmitOrder = 0;                // Submission order within the frame, to return items top-to-bottom like the GatherTask does
+    int                     AppearFrame = -1;               // Generation: frame when item last appeared (was not submitted the frame before)
+};
+
+struct ImGuiTestItemGraphLink
+{
+    ImGuiID                 ParentID = 0;
+    int                     LinkFrame = -1;                 // Last frame when ParentID was written, ID Stack walks stop at entries already linked this frame
+};
+
+struct ImGuiTestItemGraph
+{
+    int                     FirstFrame = -1;                // First frame fully recorded, -1 when disabled
+    int                     SubmitFrame = -1;
+    int                     SubmitCount = 0;
+    ImPool<ImGuiTestItemGraphItem> Items;
+    ImPool<ImGuiTestItemGraphLink> Links;
+    ImGuiTestItemGraphItem* LastItem = nullptr;             // Last item added, for ItemInfo() hook
+
+    bool IsReady(int frame_count) const { return FirstFrame != -1 && FirstFrame <= frame_count; }
+    void Clear()                { FirstFrame = SubmitFrame = -1; SubmitCount = 0; Items.Clear(); Links.Clear(); LastItem = nullptr; }
+};
+
 enum ImGuiTestInputType
 {
     ImGuiTestInputType_None,
     ImGuiTestInputType_Key,
     ImGuiTestInputType_Char,
+    ImGuiTestInputType_Text,
+    ImGuiTestInputType_MouseButton,
     ImGuiTestInputType_ViewportFocus,
     ImGuiTestInputType_ViewportSetPos,
     ImGuiTestInputType_ViewportSetSize,
@@ -81,9 +115,13 @@ struct ImGuiTestInput
     ImGuiTestInputType      Type = ImGuiTestInputType_None;
     ImGuiKeyChord           KeyChord = ImGuiKey_None;
     ImWchar                 Char = 0;
+    ImGuiMouseButton        MouseButton = 0;
     bool                    Down = false;
     ImGuiID                 ViewportId = 0;
     ImVec2                  ViewportPosSize;
+    int                     TextOffset = 0;         // ImGuiTestInputType_Text: first character in ImGuiTestInputs::TextChars[]
+    int                     TextCount = 0;          // ImGuiTestInputType_Text: number of characters left to submit
+    int                     TextCharsPerFrame = 0;  // ImGuiTestInputType_Text: 0 = submit all at once
 
     static ImGuiTestInput   ForKeyChord(ImGuiKeyChord key_chord, bool down)
     {
@@ -102,6 +140,25 @@ struct ImGuiTestInput
         return inp;
     }
 
+    static ImGuiTestInput   ForText(int text_offset, int text_count, int chars_per_frame)
+    {
+        ImGuiTestInput inp;
+        inp.Type = ImGuiTestInputType_Text;
+        inp.TextOffset = text_offset;
+        inp.TextCount = text_count;
+        inp.TextCharsPerFrame = chars_per_frame;
+        return inp;
+    }
+
+    static ImGuiTestInput   ForMouseButton(ImGuiMouseButton button, bool down)
+    {
+        ImGuiTestInput inp;
+        inp.Type = ImGuiTestInputType_MouseButton;
+        inp.MouseButton = button;
+        inp.Down = down;
+        return inp;
+    }
+
     static ImGuiTestInput   ForViewportFocus(ImGuiID viewport_id)
     {
         ImGuiTestInput inp;
@@ -144,6 +201,7 @@ struct ImGuiTestInputs
     ImGuiID                     MouseHoveredViewport = 0;
     int                         MouseButtonsValue = 0x00;       // FIXME-TESTS: Use simulated_io.MouseDown[] ?
     ImVector<ImGuiTestInput>    Queue;
+    ImVector<unsigned int>      TextChars;                      // Decoded characters of queued ImGuiTestInputType_Text inputs
     bool                        HostEscDown = false;
     float                       HostEscDownDuration = -1.0f;    // Maintain our own DownDuration for host/backend ESC key so we can abort.
     ImVec2                      HostMousePos;
@@ -168,6 +226,45 @@ struct ImGuiTestEnginePerfRecord
     }
 };
 
+// One PerfCapture() result recorded while sweeping PerfStressAmount (see ImGuiTestEngineIO::PerfStressSweepSteps)
+struct ImGuiTestEnginePerfSweepPoint
+{
+    ImGuiID                     CaptureID;                      // Hash of category + test name passed to PerfCapture()
+    int                         PerfStressAmount;
+    double                      DtDeltaMs;
+};
+
+// Windows, settings, tables and docking state captured when starting first test of a batch with ImGuiTestEngineIO::ConfigRestoreUiStateBetweenTests set
+// Restored in memory before each test (no .ini text round-trip, no yield).
+struct ImGuiTestUiStateSnapshot
+{
+    struct WindowState
+    {
+        ImGuiID                 ID;
+        ImVec2                  Pos;
+        ImVec2                  SizeFull;
+        ImVec2                  Scroll;
+        bool                    Collapsed;
+        ImGuiID                 DockId;
+    };
+    bool                        Valid = false;
+    ImVector<WindowState>       Windows;
+    ImChunkStream<ImGuiWindowSettings> SettingsWindows;
+    ImChunkStream<ImGuiTableSettings>  SettingsTables;
+    ImVector<ImGuiID>           DockNodes;
+
+    void Capture(ImGuiContext& g);
+    void Restore(ImGuiContext& g);
+    void Clear()                { Valid = false; Windows.clear(); SettingsWindows.clear(); SettingsTables.clear(); DockNodes.clear(); }
+};
+
+// Result of ImGuiTestEngine_SearchLogs()
+struct ImGuiTestLogSearchResult
+{
+    ImGuiTest*                  Test;
+    int                         LineIdx;                        // Index into Test->Output.Log.LineInfo[]
+};
+
 // [Internal] Test Engine Context
 struct ImGuiTestEngine
 {
@@ -179,21 +276,50 @@ struct ImGuiTestEngine
     bool                        UiContextHasHooks = false;
     ImU64                       BatchStartTime = 0;
     ImU64                       BatchEndTime = 0;
+    ImU64                       ExportDurationUs = 0;           // Duration of last results export
+    int                         ExportThreadsCount = 0;         // Threads used by last results export (0: no export)
     int                         FrameCount = 0;
     float                       OverrideDeltaTime = -1.0f;      // Inject custom delta time into imgui context to simulate clock passing faster than wall clock time.
     ImVector<ImGuiTest*>        TestsAll;
     ImVector<ImGuiTestRunTask>  TestsQueue;
     ImGuiTestContext*           TestContext = nullptr;          // Running test context
+    ImVector<ImGuiTestContext*> TestContextPool;                // Test contexts reused across test runs, one per nesting level of child tests (keeps capacity of their buffers)
+    int                         TestContextPoolUsed = 0;
+    ImVector<char>              UserVarsArena;                  // Storage for UserVars, used as a stack as child tests may create vars while parent's are alive
+    int                         UserVarsArenaUsed = 0;
+    ImU64                       LogSizeTotal = 0;               // Sum of final log sizes of tests run so far: average is reserved for a test log before its first run
+    int                         LogLinesTotal = 0;              // Sum of final log line counts of tests run so far
+    int                         LogSizeTestsCount = 0;          // Number of tests accounted in LogSizeTotal/LogLinesTotal
+    int                         LogAllocCount = 0;              // Allocator calls made while appending to test logs so far (counted into ImGuiTestOutput::EngineAllocCount)
     bool                        TestsSourceLinesDirty = false;
+    ImSourceFileCache           SourceFiles;                    // Source files of tests, loaded on demand (e.g. to view sources)
     ImVector<ImGuiTestInfoTask*>InfoTasks;
-    ImGuiTestGatherTask         GatherTask;
+    ImVector<ImGuiTestGatherTask*> GatherTasks;                 // Active gather tasks
+    ImVector<ImGuiTestGatherTask*> GatherTasksPool;             // Removed gather tasks, reused by ImGuiTestEngine_GatherTaskAdd()
+    ImGuiStorage                GatherTasksParentIds;           // Parent ID -> 1 for all active gather tasks (sorted, binary searched)
+    ImU64                       GatherTasksParentMask = 0;      // 1 bit per (parent ID & 63): quick reject before looking up GatherTasksParentIds
+    int                         GatherTasksMaxDepth = 0;        // Max of InMaxDepth for all active gather tasks
+    int                         GatherItemSerial = 0;           // Incremented for each item processed by gather tasks hook
     ImGuiTestFindByLabelTask    FindByLabelTask;
+    ImGuiTestItemGraph          ItemGraph;                      // Enabled by IO.ConfigItemGraph
     ImGuiTestCoroutineHandle    TestQueueCoroutine = nullptr;   // Coroutine to run the test queue
     bool                        TestQueueCoroutineShouldExit = false; // Flag to indicate that we are shutting down and the test queue coroutine should stop
     ImGuiTextBuffer             StringBuilderForChecks;
+    ImGuiTestUiStateSnapshot    UiStateSnapshot;                // Captured when starting a test if IO.ConfigRestoreUiStateBetweenTests is set, cleared at end of batch
+    int                         ForkChildPipe = -1;             // When running a test in a fork() child (IO.ConfigForkIsolation): pipe to send output to parent process
+    ImGuiTest*                  ForkChildTest = nullptr;        // When running a test in a fork() child: test whose output is sent to parent process
+    ImVector<ImGuiTestRunTask>  ForkTasks;                      // Tests left to run in fork() children, one at a time (taken from TestsQueue)
+    ImVector<ImGuiTestRunTask>  ForkTasksInProcess;             // Tests moved back to TestsQueue once ForkTasks are done (perf tests)
+    int                         ForkRunningPid = -1;            // Running child process
+    int                         ForkRunningPipe = -1;           // Read end of running child's output pipe
+    ImU64                       ForkRunningStartTime = 0;
+    bool                        ForkRunningKilled = false;      // Running child was killed on timeout
+    ImVector<char>              ForkRunningOutput;              // Output received from running child so far
 
     // Inputs
     ImGuiTestInputs             Inputs;
+    ImGuiTestInputRecording*    InputRecording = nullptr;       // Recording of inputs submitted by backend (see ImGuiTestEngine_InputRecordBegin())
+    int                         InputRecordingQueueSkip = 0;    // Number of events left in queue by last NewFrame() call, which were already recorded.
 
     // UI support
     bool                        Abort = false;
@@ -208,6 +334,10 @@ struct ImGuiTestEngine
     bool                        UiStackToolOpen = false;
     bool                        UiPerfToolOpen = false;
     float                       UiLogHeight = 150.0f;
+    Str*                        UiLogSearch;
+    ImGuiID                     UiLogSearchHash = 0;            // Hash of query for UiLogSearchResults
+    int                         UiLogSearchLineCount = -1;      // Total number of log lines when UiLogSearchResults was computed
+    ImVector<ImGuiTestLogSearchResult> UiLogSearchResults;
 
     // Performance Monitor
     ImU64                       PerfTimestampPreNewFrame;
@@ -219,6 +349,19 @@ struct ImGuiTestEngine
     ImGuiTestEnginePerfRecord   PerfDtPreRenderToPreSwap;
     ImGuiTestEnginePerfRecord   PerfDtPreNewFrameToPreSwap;
     ImGuiTestEnginePerfRecord   PerfDtPreSwapToPostSwap;
+    ImPerfCounters              PerfCounters;                   // Hardware counters for main thread. Opened on first use by ImGuiTestContext::PerfCapture() when IO.ConfigPerfCounters is set.
+    bool                        PerfCountersActive = false;     // Sample PerfCounters every frame (set by ImGuiTestContext::PerfCapture()).
+    bool                        PerfCountersValid = false;      // PerfCountersPrev holds a valid sample.
+    ImU64                       PerfCountersPrev[ImPerfCounter_COUNT] = {};
+    ImU64                       PerfCountersFrame[ImPerfCounter_COUNT] = {}; // Counters for last frame (PreNewFrame to PreNewFrame).
+    bool                        PerfCpuTimeActive = false;      // Sample thread CPU time in PreNewFrame/PreRender/PreSwap (set by ImGuiTestContext::PerfCapture()).
+    ImU64                       PerfCpuTimePreNewFrame = 0;     // Thread CPU time (us) sampled in PreNewFrame hook, 0 when unavailable.
+    ImU64                       PerfCpuTimePreRender = 0;       // Thread CPU time (us) sampled in PreRender hook, 0 when unavailable.
+    double                      PerfCpuTimeBuildMs = -1.0;      // CPU time for last frame's NewFrame->Render phase, -1.0 when not measured.
+    double                      PerfCpuTimeRenderMs = -1.0;     // CPU time for last frame's Render->PreSwap phase, -1.0 when not measured.
+    int                         PerfSweepStep = -1;             // Current step when running a perf test with IO.PerfStressSweepSteps, -1 otherwise.
+    int                         PerfSweepStepsCount = -1;       // Number of steps for current perf test: IO.PerfStressSweepSteps, clamped so PerfStressAmount << step fits in an int.
+    ImVector<ImGuiTestEnginePerfSweepPoint> PerfSweepPoints;    // Results of previous steps of current sweep.
     ImGuiPerfTool*              PerfTool = nullptr;
 
     // Screen/Video Capturing
@@ -247,9 +390,14 @@ struct ImGuiTestEngine
 ImGuiTestItemInfo*  ImGuiTestEngine_FindItemInfo(ImGuiTestEngine* engine, ImGuiID id, const char* debug_id);
 void                ImGuiTestEngine_Yield(ImGuiTestEngine* engine);
 void                ImGuiTestEngine_SetDeltaTime(ImGuiTestEngine* engine, float delta_time);
+bool                ImGuiTestEngine_IsUsingVirtualTime(ImGuiTestEngine* engine);
 int                 ImGuiTestEngine_GetFrameCount(ImGuiTestEngine* engine);
+ImGuiTestGatherTask*ImGuiTestEngine_GatherTaskAdd(ImGuiTestEngine* engine, ImGuiID parent_id, int max_depth, short layer_mask, ImGuiTestItemList* out_list);
+void                ImGuiTestEngine_GatherTaskRemove(ImGuiTestEngine* engine, ImGuiTestGatherTask* task);
+bool                ImGuiTestEngine_GatherItemsFromGraph(ImGuiTestEngine* engine, ImGuiTestItemList* out_list, ImGuiID parent_id, int max_depth, short layer_mask, int* out_appeared_count);
 bool                ImGuiTestEngine_PassFilter(ImGuiTest* test, const char* filter);
 void                ImGuiTestEngine_RunTest(ImGuiTestEngine* engine, ImGuiTestContext* ctx, ImGuiTest* test, ImGuiTestRunFlags run_flags);
+int                 ImGuiTestEngine_GetAllocCount(ImGuiContext* ui_ctx);
 
 void                ImGuiTestEngine_BindImGuiContext(ImGuiTestEngine* engine, ImGuiContext* ui_ctx);
 void                ImGuiTestEngine_UnbindImGuiContext(ImGuiTestEngine* engine, ImGuiContext* ui_ctx);
@@ -257,6 +405,7 @@ void                ImGuiTestEngine_UnbindImGuiContext(ImGuiTestEngine* engine,
 void                ImGuiTestEngine_RebootUiContext(ImGuiTestEngine* engine);
 ImGuiPerfTool*      ImGuiTestEngine_GetPerfTool(ImGuiTestEngine* engine);
 void                ImGuiTestEngine_UpdateTestsSourceLines(ImGuiTestEngine* engine);
+int                 ImGuiTestEngine_SearchLogs(ImGuiTestEngine* engine, const char* query, ImVector<ImGuiTestLogSearchResult>* out_results);
 
 // Screen/Video Capturing
 bool                ImGuiTestEngine_CaptureScreenshot(ImGuiTestEngine* engine, ImGuiCaptureArgs* args);
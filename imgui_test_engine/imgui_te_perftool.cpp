@@ -75,6 +75,9 @@ void ImGuiPerfToolEntry::Set(const ImGuiPerfToolEntry& other)
     DtDeltaMsMin = other.DtDeltaMsMin;
     DtDeltaMsMax = other.DtDeltaMsMax;
     NumSamples = other.NumSamples;
+    NumSamplesWithCounters = other.NumSamplesWithCounters;
+    NumSamplesWithCpuTime = other.NumSamplesWithCpuTime;
+    NumSamplesWithScaling = other.NumSamplesWithScaling;
     PerfStressAmount = other.PerfStressAmount;
     GitBranchName = other.GitBranchName;
     BuildType = other.BuildType;
@@ -82,9 +85,21 @@ void ImGuiPerfToolEntry::Set(const ImGuiPerfToolEntry& other)
     OS = other.OS;
     Compiler = other.Compiler;
     Date = other.Date;
+    Instructions = other.Instructions;
+    Cycles = other.Cycles;
+    CacheMisses = other.CacheMisses;
+    BranchMisses = other.BranchMisses;
+    CpuBuildMs = other.CpuBuildMs;
+    CpuRenderMs = other.CpuRenderMs;
+    ScalingPoints = other.ScalingPoints;
+    ScalingExponent = other.ScalingExponent;
+    ScalingCostMs = other.ScalingCostMs;
     //DateMax = ...
     VsBaseline = other.VsBaseline;
     LabelIndex = other.LabelIndex;
+    TestNameID = other.TestNameID;
+    BuildID = other.BuildID;
+    BuildStressID = other.BuildStressID;
 }
 
 //-------------------------------------------------------------------------
@@ -119,11 +134,83 @@ static const ImGuiPerfToolColumnInfo PerfToolColumnInfo[] =
     { /* 07 */ "Stress",      offsetof(ImGuiPerfToolEntry, PerfStressAmount), ImGuiDataType_S32,    true,  0 },
     { /* 08 */ "Avg ms",      offsetof(ImGuiPerfToolEntry, DtDeltaMs),        ImGuiDataType_Double, true,  0 },
     { /* 09 */ "Min ms",      offsetof(ImGuiPerfToolEntry, DtDeltaMsMin),     ImGuiDataType_Double, false, 0 },
-    { /* 00 */ "Max ms",      offsetof(ImGuiPerfToolEntry, DtDeltaMsMax),     ImGuiDataType_Double, false, 0 },
+    { /* 10 */ "Max ms",      offsetof(ImGuiPerfToolEntry, DtDeltaMsMax),     ImGuiDataType_Double, false, 0 },
     { /* 11 */ "Samples",     offsetof(ImGuiPerfToolEntry, NumSamples),       ImGuiDataType_S32,    false, 0 },
     { /* 12 */ "VS Baseline", offsetof(ImGuiPerfToolEntry, VsBaseline),       ImGuiDataType_Float,  true,  0 },
+    { /* 13 */ "Instr/frame", offsetof(ImGuiPerfToolEntry, Instructions),     ImGuiDataType_Double, true,  ImGuiTableColumnFlags_DefaultHide },
+    { /* 14 */ "Cycles/frame",offsetof(ImGuiPerfToolEntry, Cycles),           ImGuiDataType_Double, true,  ImGuiTableColumnFlags_DefaultHide },
+    { /* 15 */ "Cache Miss",  offsetof(ImGuiPerfToolEntry, CacheMisses),      ImGuiDataType_Double, true,  ImGuiTableColumnFlags_DefaultHide },
+    { /* 16 */ "Branch Miss", offsetof(ImGuiPerfToolEntry, BranchMisses),     ImGuiDataType_Double, true,  ImGuiTableColumnFlags_DefaultHide },
+    { /* 17 */ "CPU Build ms",offsetof(ImGuiPerfToolEntry, CpuBuildMs),       ImGuiDataType_Double, true,  ImGuiTableColumnFlags_DefaultHide },
+    { /* 18 */ "CPU Rend. ms",offsetof(ImGuiPerfToolEntry, CpuRenderMs),      ImGuiDataType_Double, true,  ImGuiTableColumnFlags_DefaultHide },
+    { /* 19 */ "Scaling",     offsetof(ImGuiPerfToolEntry, ScalingExponent),  ImGuiDataType_Double, true,  ImGuiTableColumnFlags_DefaultHide },
+    { /* 20 */ "ms/Stress",   offsetof(ImGuiPerfToolEntry, ScalingCostMs),    ImGuiDataType_Double, true,  ImGuiTableColumnFlags_DefaultHide },
 };
 
+static bool HasPerfCounters(const ImGuiPerfToolEntry* entry)
+{
+    return entry->Instructions > 0.0 || entry->Cycles > 0.0 || entry->CacheMisses > 0.0 || entry->BranchMisses > 0.0;
+}
+
+static void FormatPerfCounter(const ImGuiPerfToolEntry* entry, double value, Str& out_label)
+{
+    if (HasPerfCounters(entry))
+        out_label.setf("%.0f", value);
+    else
+        out_label.set("--");
+}
+
+static bool HasCpuTime(const ImGuiPerfToolEntry* entry)
+{
+    return entry->CpuBuildMs > 0.0 || entry->CpuRenderMs > 0.0;
+}
+
+static void FormatCpuTime(const ImGuiPerfToolEntry* entry, double value, Str& out_label)
+{
+    if (HasCpuTime(entry))
+        out_label.setf("%.3f", value);
+    else
+        out_label.set("--");
+}
+
+// Scaling exponent increase vs baseline over which a test is reported as scaling worse (e.g. 1.0 -> 1.3 when something became O(n^2) for a subset of items).
+static const double PerfToolScalingExponentRegressionThreshold = 0.25;
+
+static bool HasScaling(const ImGuiPerfToolEntry* entry)
+{
+    return entry->ScalingPoints > 0;
+}
+
+static void FormatScaling(const ImGuiPerfToolEntry* entry, const ImGuiPerfToolEntry* baseline_entry, Str& out_label)
+{
+    if (!HasScaling(entry))
+    {
+        out_label.set("--");
+        return;
+    }
+    out_label.setf("%.2f", entry->ScalingExponent);
+    if (baseline_entry != nullptr && baseline_entry != entry && HasScaling(baseline_entry))
+        if (entry->ScalingExponent - baseline_entry->ScalingExponent > PerfToolScalingExponentRegressionThreshold)
+            out_label.appendf(" (was %.2f!)", baseline_entry->ScalingExponent);
+}
+
+static bool IsScalingRegression(const ImGuiPerfToolEntry* entry, const ImGuiPerfToolEntry* baseline_entry)
+{
+    if (baseline_entry == nullptr || baseline_entry == entry || !HasScaling(entry) || !HasScaling(baseline_entry))
+        return false;
+    return entry->ScalingExponent - baseline_entry->ScalingExponent > PerfToolScalingExponentRegressionThreshold;
+}
+
+static double PerfToolGetPlotValue(const ImGuiPerfToolEntry* entry, ImGuiPerfToolPlotMetric metric)
+{
+    switch (metric)
+    {
+    case ImGuiPerfToolPlotMetric_CpuBuild:  return entry->CpuBuildMs;
+    case ImGuiPerfToolPlotMetric_CpuRender: return entry->CpuRenderMs;
+    default:                                return entry->DtDeltaMs;
+    }
+}
+
 static const char* PerfToolReportDefaultOutputPath = "./output/capture_perf_report.html";
 
 // This is declared as a standalone function in order to run without a PerfTool instance
@@ -145,13 +232,51 @@ void ImGuiTestEngine_PerfToolAppendToCSV(ImGuiPerfToolEntry* entry, const char*
         fprintf(stderr, "Unable to open '%s', perftool entry was not saved.\n", filename);
         return;
     }
-    fprintf(f, "%llu,%s,%s,%.3f,x%d,%s,%s,%s,%s,%s,%s\n", entry->Timestamp, entry->Category, entry->TestName,
+    fprintf(f, "%llu,%s,%s,%.3f,x%d,%s,%s,%s,%s,%s,%s,%.0f,%.0f,%.0f,%.0f,%.4f,%.4f,%d,%.4f,%.6f\n", entry->Timestamp, entry->Category, entry->TestName,
             entry->DtDeltaMs, entry->PerfStressAmount, entry->GitBranchName, entry->BuildType, entry->Cpu, entry->OS,
-            entry->Compiler, entry->Date);
+            entry->Compiler, entry->Date, entry->Instructions, entry->Cycles, entry->CacheMisses, entry->BranchMisses,
+            entry->CpuBuildMs, entry->CpuRenderMs, entry->ScalingPoints, entry->ScalingExponent, entry->ScalingCostMs);
     fflush(f);
     fclose(f);
 }
 
+// Fit results of a same perf test captured at different stress amounts:
+// - Cost per stress unit: slope of least squares fit of DtDeltaMs = a + cost * PerfStressAmount.
+// - Exponent: slope of least squares fit of log(DtDeltaMs) = b + k * log(PerfStressAmount). Only positive results are used.
+bool ImGuiTestEngine_PerfToolFitScaling(const int* stress_amounts, const double* dt_deltas_ms, int count, double* out_exponent, double* out_cost_ms)
+{
+    double sum_x = 0.0, sum_y = 0.0, sum_xx = 0.0, sum_xy = 0.0;
+    double sum_log_x = 0.0, sum_log_y = 0.0, sum_log_xx = 0.0, sum_log_xy = 0.0;
+    int log_count = 0;
+    for (int n = 0; n < count; n++)
+    {
+        const double x = (double)stress_amounts[n];
+        const double y = dt_deltas_ms[n];
+        sum_x += x;
+        sum_y += y;
+        sum_xx += x * x;
+        sum_xy += x * y;
+        if (x > 0.0 && y > 0.0)
+        {
+            const double log_x = log(x);
+            const double log_y = log(y);
+            sum_log_x += log_x;
+            sum_log_y += log_y;
+            sum_log_xx += log_x * log_x;
+            sum_log_xy += log_x * log_y;
+            log_count++;
+        }
+    }
+
+    const double det = count * sum_xx - sum_x * sum_x;
+    const double log_det = log_count * sum_log_xx - sum_log_x * sum_log_x;
+    if (count < 2 || log_count < 2 || det <= 0.0 || log_det <= 1e-9)
+        return false;   // Not enough distinct stress amounts.
+    *out_cost_ms = (count * sum_xy - sum_x * sum_y) / det;
+    *out_exponent = (log_count * sum_log_xy - sum_log_x * sum_log_y) / log_det;
+    return true;
+}
+
 // Tri-state button. Copied and modified ButtonEx().
 static bool Button3(const char* label, int* value)
 {
@@ -207,7 +332,7 @@ static bool Button3(const char* label, int* value)
 
 
 
-static ImGuiID GetBuildID(const ImGuiPerfToolEntry* entry)
+static ImGuiID CalcBuildID(const ImGuiPerfToolEntry* entry)
 {
     IM_ASSERT(entry != nullptr);
     ImGuiID build_id = ImHashStr(entry->BuildType);
@@ -218,6 +343,13 @@ static ImGuiID GetBuildID(const ImGuiPerfToolEntry* entry)
     return build_id;
 }
 
+// Build ID is calculated once by ImGuiPerfTool::AddEntry()
+static ImGuiID GetBuildID(const ImGuiPerfToolEntry* entry)
+{
+    IM_ASSERT(entry != nullptr);
+    return entry->BuildID;
+}
+
 static ImGuiID GetBuildID(const ImGuiPerfToolBatch* batch)
 {
     IM_ASSERT(batch != nullptr);
@@ -225,17 +357,6 @@ static ImGuiID GetBuildID(const ImGuiPerfToolBatch* batch)
     return GetBuildID(&batch->Entries.Data[0]);
 }
 
-// Batch ID depends on display type. It is either a build ID (when combinding by build type) or batch timestamp otherwise.
-static ImGuiID GetBatchID(const ImGuiPerfTool* perftool, const ImGuiPerfToolEntry* entry)
-{
-    IM_ASSERT(perftool != nullptr);
-    IM_ASSERT(entry != nullptr);
-    if (perftool->_DisplayType == ImGuiPerfToolDisplayType_CombineByBuildInfo)
-        return GetBuildID(entry);
-    else
-        return (ImU32)entry->Timestamp;
-}
-
 static int PerfToolComparerStr(const void* a, const void* b)
 {
     return strcmp(*(const char**)b, *(const char**)a);
@@ -247,20 +368,20 @@ static int IMGUI_CDECL PerfToolComparerByEntryInfo(const void* lhs, const void*
     const ImGuiPerfToolEntry* b = (const ImGuiPerfToolEntry*)rhs;
 
     // While build ID does include git branch it wont ensure branches are grouped together, therefore we do branch
-    // sorting manually.
-    int result = strcmp(a->GitBranchName, b->GitBranchName);
+    // sorting manually. Strings are interned by AddEntry() so equal strings can be compared by pointer first.
+    int result = (a->GitBranchName == b->GitBranchName) ? 0 : strcmp(a->GitBranchName, b->GitBranchName);
 
-    // Now that we have groups of branches - sort individual builds within those groups.
-    if (result == 0)
-        result = ImClamp<int>((int)((ImS64)GetBuildID(a) - (ImS64)GetBuildID(b)), -1, +1);
+    // Now that we have groups of branches - sort individual builds (and stress amounts of a build) within those groups.
+    if (result == 0 && a->BuildStressID != b->BuildStressID)
+        result = (a->BuildStressID < b->BuildStressID) ? -1 : +1;
 
     // Group individual runs together within build groups.
-    if (result == 0)
-        result = (int)ImClamp<ImS64>((ImS64)b->Timestamp - (ImS64)a->Timestamp, -1, +1);
+    if (result == 0 && a->Timestamp != b->Timestamp)
+        result = (b->Timestamp < a->Timestamp) ? -1 : +1;
 
     // And finally sort individual runs by perf name so we can have a predictable order (used to optimize in _Rebuild()).
-    if (result == 0)
-        result = (int)strcmp(a->TestName, b->TestName);
+    if (result == 0 && a->TestName != b->TestName)
+        result = strcmp(a->TestName, b->TestName);
 
     return result;
 }
@@ -298,8 +419,13 @@ static int IMGUI_CDECL CompareWithSortSpecs(const void* lhs, const void* rhs)
             result = (int)((col_info.GetValue<float>(a) - col_info.GetValue<float>(b)) * 1000.0f);
             break;
         case ImGuiDataType_Double:
-            result = (int)((col_info.GetValue<double>(a) - col_info.GetValue<double>(b)) * 1000.0);
+        {
+            // Compare instead of subtracting: hardware counters values may overflow an int.
+            const double value_a = col_info.GetValue<double>(a);
+            const double value_b = col_info.GetValue<double>(b);
+            result = (value_a < value_b) ? -1 : (value_a > value_b) ? +1 : 0;
             break;
+        }
         case ImGuiDataType_String:
             result = strcmp(col_info.GetValue<const char*>(a), col_info.GetValue<const char*>(b));
             break;
@@ -382,17 +508,12 @@ static void PerfToolFormatBuildInfo(ImGuiPerfTool* perftool, Str* result, ImGuiP
 
 static int PerfToolCountBuilds(ImGuiPerfTool* perftool, bool only_visible)
 {
+    if (!only_visible)
+        return perftool->_SrcBuilds.Size;
     int num_builds = 0;
-    ImU64 build_id = 0;
-    for (ImGuiPerfToolEntry& entry : perftool->_SrcData)
-    {
-        if (build_id != GetBuildID(&entry))
-        {
-            if (!only_visible || perftool->_IsVisibleBuild(&entry))
-                num_builds++;
-            build_id = GetBuildID(&entry);
-        }
-    }
+    for (ImGuiPerfToolBuild& build : perftool->_SrcBuilds)
+        if (perftool->_IsVisibleBuild(&perftool->_SrcData[perftool->_SrcRuns[build.RunIndex].SrcIndex]))
+            num_builds++;
     return num_builds;
 }
 
@@ -549,6 +670,7 @@ ImGuiPerfTool::ImGuiPerfTool()
 ImGuiPerfTool::~ImGuiPerfTool()
 {
     _SrcData.clear_destruct();
+    _SrcBuildAggregates.clear_destruct();
     _Batches.clear_destruct();
     IM_DELETE(_CsvParser);
 }
@@ -561,40 +683,117 @@ void ImGuiPerfTool::AddEntry(ImGuiPerfToolEntry* entry)
         ImStrncpy(_FilterDateTo, entry->Date, IM_COUNTOF(_FilterDateTo));
 
     _SrcData.push_back(*entry);
+    _SrcDataDirty = true;
     _Batches.clear_destruct();
+
+    // Intern strings and calculate hashes once, so _Rebuild() never needs to hash or compare them again.
+    ImGuiPerfToolEntry* new_entry = &_SrcData.back();
+    new_entry->Category = _InternString(new_entry->Category);
+    new_entry->TestName = _InternString(new_entry->TestName, &new_entry->TestNameID);
+    new_entry->GitBranchName = _InternString(new_entry->GitBranchName);
+    new_entry->BuildType = _InternString(new_entry->BuildType);
+    new_entry->Cpu = _InternString(new_entry->Cpu);
+    new_entry->OS = _InternString(new_entry->OS);
+    new_entry->Compiler = _InternString(new_entry->Compiler);
+    new_entry->Date = _InternString(new_entry->Date);
+    new_entry->BuildID = CalcBuildID(new_entry);
+    new_entry->BuildStressID = ImHashData(&new_entry->PerfStressAmount, sizeof(new_entry->PerfStressAmount), new_entry->BuildID);
 }
 
-void ImGuiPerfTool::_Rebuild()
+// Return pointer shared by all equal strings, and optionally a key which is unique to this string.
+const char* ImGuiPerfTool::_InternString(const char* str, ImGuiID* out_id)
 {
-    if (_SrcData.empty())
-        return;
+    // Different strings with a same hash are stored at next free key (lookups probe keys in the same order).
+    for (ImGuiID str_id = ImHashStr(str); ; str_id++)
+    {
+        const char* interned_str = (const char*)_SrcStrings.GetVoidPtr(str_id);
+        if (interned_str == nullptr)
+            _SrcStrings.SetVoidPtr(str_id, (void*)(interned_str = str));
+        else if (interned_str != str && strcmp(interned_str, str) != 0)
+            continue;
+        if (out_id)
+            *out_id = str_id;
+        return interned_str;
+    }
+}
 
-    ImGuiStorage& temp_set = _TempSet;
-    _Labels.resize(0);
-    _LabelsVisible.resize(0);
-    _InfoTableSort.resize(0);
-    _Batches.clear_destruct();
-    _InfoTableSortDirty = true;
+// Reset sums of an entry used to aggregate other entries with PerfToolAccumulateEntry()/PerfToolMergeAggregate().
+static void PerfToolResetAggregate(ImGuiPerfToolEntry* aggregate)
+{
+    aggregate->DtDeltaMs = 0;
+    aggregate->NumSamples = 0;
+    aggregate->Instructions = aggregate->Cycles = aggregate->CacheMisses = aggregate->BranchMisses = 0.0;
+    aggregate->NumSamplesWithCounters = 0;
+    aggregate->CpuBuildMs = aggregate->CpuRenderMs = 0.0;
+    aggregate->NumSamplesWithCpuTime = 0;
+    aggregate->ScalingPoints = 0;
+    aggregate->ScalingExponent = aggregate->ScalingCostMs = 0.0;
+    aggregate->NumSamplesWithScaling = 0;
+}
 
-    // Gather all visible labels. Legend batches will store data in this order.
-    temp_set.Data.resize(0);    // name_id:IsLabelSeen
-    for (ImGuiPerfToolEntry& entry : _SrcData)
+// Add a raw entry to sums. Averages are calculated by _Rebuild() once all entries of a batch are added.
+static void PerfToolAccumulateEntry(ImGuiPerfToolEntry* aggregate, const ImGuiPerfToolEntry* e)
+{
+    aggregate->DtDeltaMs += e->DtDeltaMs;
+    aggregate->NumSamples++;
+    aggregate->DtDeltaMsMin = ImMin(aggregate->DtDeltaMsMin, e->DtDeltaMs);
+    aggregate->DtDeltaMsMax = ImMax(aggregate->DtDeltaMsMax, e->DtDeltaMs);
+    if (HasPerfCounters(e))
     {
-        ImGuiID name_id = ImHashStr(entry.TestName);
-        if (!temp_set.GetBool(name_id))
-        {
-            temp_set.SetBool(name_id, true);
-            _Labels.push_back(entry.TestName);
-            if (_IsVisibleTest(entry.TestName))
-                _LabelsVisible.push_front(entry.TestName);
-        }
+        aggregate->Instructions += e->Instructions;
+        aggregate->Cycles += e->Cycles;
+        aggregate->CacheMisses += e->CacheMisses;
+        aggregate->BranchMisses += e->BranchMisses;
+        aggregate->NumSamplesWithCounters++;
     }
-    int num_visible_labels = _LabelsVisible.Size;
+    if (HasCpuTime(e))
+    {
+        aggregate->CpuBuildMs += e->CpuBuildMs;
+        aggregate->CpuRenderMs += e->CpuRenderMs;
+        aggregate->NumSamplesWithCpuTime++;
+    }
+    if (HasScaling(e))
+    {
+        aggregate->ScalingPoints = ImMax(aggregate->ScalingPoints, e->ScalingPoints);
+        aggregate->ScalingExponent += e->ScalingExponent;
+        aggregate->ScalingCostMs += e->ScalingCostMs;
+        aggregate->NumSamplesWithScaling++;
+    }
+}
 
-    // Labels are sorted in reverse order so they appear to be oredered from top down.
-    ImQsort(_Labels.Data, _Labels.Size, sizeof(const char*), &PerfToolComparerStr);
-    ImQsort(_LabelsVisible.Data, num_visible_labels, sizeof(const char*), &PerfToolComparerStr);
+// Add sums of another aggregate (e.g. ImGuiPerfTool::_SrcBuildAggregates). Same result as adding each of its entries with PerfToolAccumulateEntry().
+static void PerfToolMergeAggregate(ImGuiPerfToolEntry* aggregate, const ImGuiPerfToolEntry* src)
+{
+    aggregate->DtDeltaMs += src->DtDeltaMs;
+    aggregate->NumSamples += src->NumSamples;
+    aggregate->DtDeltaMsMin = ImMin(aggregate->DtDeltaMsMin, src->DtDeltaMsMin);
+    aggregate->DtDeltaMsMax = ImMax(aggregate->DtDeltaMsMax, src->DtDeltaMsMax);
+    aggregate->Instructions += src->Instructions;
+    aggregate->Cycles += src->Cycles;
+    aggregate->CacheMisses += src->CacheMisses;
+    aggregate->BranchMisses += src->BranchMisses;
+    aggregate->NumSamplesWithCounters += src->NumSamplesWithCounters;
+    aggregate->CpuBuildMs += src->CpuBuildMs;
+    aggregate->CpuRenderMs += src->CpuRenderMs;
+    aggregate->NumSamplesWithCpuTime += src->NumSamplesWithCpuTime;
+    aggregate->ScalingPoints = ImMax(aggregate->ScalingPoints, src->ScalingPoints);
+    aggregate->ScalingExponent += src->ScalingExponent;
+    aggregate->ScalingCostMs += src->ScalingCostMs;
+    aggregate->NumSamplesWithScaling += src->NumSamplesWithScaling;
+}
 
+static bool PerfToolIsDateRangeVisible(const ImGuiPerfTool* perftool, const char* date_min, const char* date_max)
+{
+    if (perftool->_FilterDateFrom[0] && strcmp(date_min, perftool->_FilterDateFrom) < 0)
+        return false;
+    if (perftool->_FilterDateTo[0] && strcmp(date_max, perftool->_FilterDateTo) > 0)
+        return false;
+    return true;
+}
+
+// Sort _SrcData and index it into runs and labels. This is only done when new entries were added.
+void ImGuiPerfTool::_RebuildIndex()
+{
     // _SrcData vector stores sorted raw entries of imgui_perflog.csv. Sorting is very important,
     // algorithm depends on data being correctly sorted. Sorting _SrcData is OK, because it is only
     // ever appended to and never written out to disk. Entries are sorted by multiple criteria,
@@ -608,88 +807,206 @@ void ImGuiPerfTool::_Rebuild()
     // entries by build ID instead of timestamp, when appropriate display mode is enabled.
     ImQsort(_SrcData.Data, _SrcData.Size, sizeof(ImGuiPerfToolEntry), &PerfToolComparerByEntryInfo);
 
+    // Split sorted data into runs: one run per unique (build, stress amount, timestamp).
+    _SrcRuns.resize(0);
+    for (int n = 0; n < _SrcData.Size; n++)
+    {
+        ImGuiPerfToolEntry* entry = &_SrcData.Data[n];
+        if (_SrcRuns.empty() || _SrcRuns.back().BuildStressID != entry->BuildStressID || _SrcRuns.back().Timestamp != entry->Timestamp)
+        {
+            _SrcRuns.push_back(ImGuiPerfToolRun());
+            ImGuiPerfToolRun& run = _SrcRuns.back();
+            run.SrcIndex = n;
+            run.Timestamp = entry->Timestamp;
+            run.BuildStressID = entry->BuildStressID;
+            run.Date = entry->Date;
+        }
+        _SrcRuns.back().SrcCount++;
+    }
+
+    // Group runs into builds and aggregate entries of each build per test.
+    // Runs of a same build are consecutive: _SrcData is sorted by build ID (which includes branch name) and stress amount before timestamp.
+    ImGuiStorage& temp_set = _TempSet;
+    _SrcBuilds.resize(0);
+    _SrcBuildAggregates.resize(0);
+    for (int run_n = 0; run_n < _SrcRuns.Size; run_n++)
+    {
+        ImGuiPerfToolRun* run = &_SrcRuns.Data[run_n];
+        if (_SrcBuilds.empty() || _SrcRuns.Data[_SrcBuilds.back().RunIndex].BuildStressID != run->BuildStressID)
+        {
+            _SrcBuilds.push_back(ImGuiPerfToolBuild());
+            ImGuiPerfToolBuild& build = _SrcBuilds.back();
+            build.RunIndex = run_n;
+            build.AggregateIndex = _SrcBuildAggregates.Size;
+            build.DateMin = build.DateMax = run->Date;
+            temp_set.Data.resize(0);    // TestNameID:aggregate_index
+        }
+        ImGuiPerfToolBuild& build = _SrcBuilds.back();
+        build.RunCount++;
+        if (strcmp(run->Date, build.DateMin) < 0)
+            build.DateMin = run->Date;
+        if (strcmp(run->Date, build.DateMax) > 0)
+            build.DateMax = run->Date;
+        run->BuildIndex = _SrcBuilds.Size - 1;
+        for (const ImGuiPerfToolEntry* e = &_SrcData.Data[run->SrcIndex], *e_end = e + run->SrcCount; e < e_end; e++)
+        {
+            int aggregate_index = temp_set.GetInt(e->TestNameID, -1);
+            if (aggregate_index == -1)
+            {
+                aggregate_index = _SrcBuildAggregates.Size;
+                temp_set.SetInt(e->TestNameID, aggregate_index);
+                _SrcBuildAggregates.push_back(*e);
+                PerfToolResetAggregate(&_SrcBuildAggregates.back());
+                build.AggregateCount++;
+            }
+            PerfToolAccumulateEntry(&_SrcBuildAggregates.Data[aggregate_index], e);
+        }
+    }
+
+    // Gather unique labels. Labels are sorted in reverse order so they appear to be ordered from top down.
+    temp_set.Data.resize(0);    // TestNameID:IsLabelSeen
+    _SrcLabels.resize(0);
+    for (ImGuiPerfToolEntry& entry : _SrcData)
+        if (!temp_set.GetBool(entry.TestNameID))
+        {
+            temp_set.SetBool(entry.TestNameID, true);
+            _SrcLabels.push_back(entry.TestName);
+        }
+    ImQsort(_SrcLabels.Data, _SrcLabels.Size, sizeof(const char*), &PerfToolComparerStr);
+    temp_set.Data.resize(0);
+
+    _NumUniqueBuilds = PerfToolCountBuilds(this, false);
+    _SrcDataDirty = false;
+}
+
+void ImGuiPerfTool::_Rebuild()
+{
+    if (_SrcData.empty())
+        return;
+
+    // Sorting and indexing is only done when new data was added. Changing filters or display type reuses the index.
+    if (_SrcDataDirty)
+        _RebuildIndex();
+
+    ImGuiStorage& temp_set = _TempSet;
+    _Labels.resize(0);
+    _LabelsVisible.resize(0);
+    _InfoTableSort.resize(0);
+    _Batches.clear_destruct();
+    _InfoTableSortDirty = true;
+
+    // Gather all visible labels. Legend batches will store data in this order.
+    // Also map TestNameID -> visible label index, so aggregation below is a single pass over each run.
+    temp_set.Data.resize(0);    // TestNameID:visible_label_index
+    ImVector<ImGuiID> visible_label_ids;
+    for (const char* label : _SrcLabels)
+    {
+        _Labels.push_back(label);
+        if (_IsVisibleTest(label))
+        {
+            ImGuiID label_id;
+            _InternString(label, &label_id);
+            temp_set.SetInt(label_id, _LabelsVisible.Size);
+            visible_label_ids.push_back(label_id);
+            _LabelsVisible.push_back(label);
+        }
+    }
+    int num_visible_labels = _LabelsVisible.Size;
+
     // Sort groups of entries into batches.
     const bool combine_by_build_info = _DisplayType == ImGuiPerfToolDisplayType_CombineByBuildInfo;
     _LabelBarCounts.Data.resize(0);
 
-    // Process all batches. `entry` is always a first batch element (guaranteed by _SrcData being sorted by timestamp).
-    // At the end of this loop we fast-forward until next batch (first entry having different batch id (which is a
-    // timestamp or build info)).
-    for (ImGuiPerfToolEntry* entry = _SrcData.begin(); entry < _SrcData.end();)
+    // Process all runs. A batch is made of a single run, or of all consecutive runs with same build info when
+    // combining by build info (guaranteed by _SrcData being sorted by build id, then timestamp).
+    for (int run_n = 0; run_n < _SrcRuns.Size;)
     {
-        // Filtered out entries can be safely ignored. Note that entry++ does not follow logic of fast-forwarding to the
-        // next batch, as found at the end of this loop. This is OK, because all entries belonging to a same batch will
-        // also have same date.
-        if ((_FilterDateFrom[0] && strcmp(entry->Date, _FilterDateFrom) < 0) || (_FilterDateTo[0] && strcmp(entry->Date, _FilterDateTo) > 0))
+        // Filtered out runs can be safely ignored: all entries belonging to a same run have same date.
+        const ImGuiPerfToolRun* run = &_SrcRuns.Data[run_n];
+        if (!PerfToolIsDateRangeVisible(this, run->Date, run->Date))
         {
-            entry++;
+            run_n++;
             continue;
         }
 
         _Batches.push_back(ImGuiPerfToolBatch());
         ImGuiPerfToolBatch& batch = _Batches.back();
-        batch.BatchID = GetBatchID(this, entry);
+        batch.BatchID = combine_by_build_info ? run->BuildStressID : (ImU32)run->Timestamp;
         batch.Entries.resize(num_visible_labels);
+        batch.NumSamples = 0;
 
         // Fill in defaults. Done once before data aggregation loop, because same entry may be touched multiple times in
         // the following loop when entries are being combined by build info.
+        const ImGuiPerfToolEntry* first_entry = &_SrcData.Data[run->SrcIndex];
         for (int i = 0; i < num_visible_labels; i++)
         {
             ImGuiPerfToolEntry* e = &batch.Entries.Data[i];
-            *e = *entry;
-            e->DtDeltaMs = 0;
-            e->NumSamples = 0;
+            *e = *first_entry;
+            PerfToolResetAggregate(e);
             e->LabelIndex = i;
             e->TestName = _LabelsVisible.Data[i];
+            e->TestNameID = visible_label_ids.Data[i];
         }
 
-        // Find perf test runs for this particular batch and accumulate them.
-        for (int i = 0; i < num_visible_labels; i++)
+        // Accumulate perf test runs for this batch.
+        // When combining a build which has none of its runs filtered out, add its pre-aggregated entries instead.
+        const ImGuiPerfToolBuild* build = &_SrcBuilds.Data[run->BuildIndex];
+        if (combine_by_build_info && run_n == build->RunIndex && PerfToolIsDateRangeVisible(this, build->DateMin, build->DateMax))
         {
-            // This inner loop walks all entries that belong to current batch. Due to sorting we are sure that batch
-            // always starts with `entry`, and all entries that belong to a batch (whether we combine by build info or not)
-            // will be grouped in _SrcData.
-            ImGuiPerfToolEntry* aggregate = &batch.Entries.Data[i];
-            for (ImGuiPerfToolEntry* e = entry; e < _SrcData.end() && GetBatchID(this, e) == batch.BatchID; e++)
+            batch.NumSamples = build->RunCount;
+            for (const ImGuiPerfToolEntry* e = &_SrcBuildAggregates.Data[build->AggregateIndex], *e_end = e + build->AggregateCount; e < e_end; e++)
             {
-                if (strcmp(e->TestName, aggregate->TestName) != 0)
-                    continue;
-                aggregate->DtDeltaMs += e->DtDeltaMs;
-                aggregate->NumSamples++;
-                aggregate->DtDeltaMsMin = ImMin(aggregate->DtDeltaMsMin, e->DtDeltaMs);
-                aggregate->DtDeltaMsMax = ImMax(aggregate->DtDeltaMsMax, e->DtDeltaMs);
+                const int label_index = temp_set.GetInt(e->TestNameID, -1);
+                if (label_index >= 0)
+                    PerfToolMergeAggregate(&batch.Entries.Data[label_index], e);
             }
+            run_n += build->RunCount;
         }
-
-        // In case data is combined by build info, DtDeltaMs will be a sum of all combined entries. Average it out.
-        if (combine_by_build_info)
-            for (int i = 0; i < num_visible_labels; i++)
-            {
-                ImGuiPerfToolEntry* aggregate = &batch.Entries.Data[i];
-                if (aggregate->NumSamples > 0)
-                    aggregate->DtDeltaMs /= aggregate->NumSamples;
-            }
-
-        // Advance to the next batch.
-        batch.NumSamples = 1;
-        if (combine_by_build_info)
+        else
         {
-            ImU64 last_timestamp = entry->Timestamp;
-            for (ImGuiID build_id = GetBuildID(entry); entry < _SrcData.end() && build_id == GetBuildID(entry);)
+            const ImGuiID build_stress_id = run->BuildStressID;
+            do
             {
-                // Also count how many unique batches participate in this aggregated batch.
-                if (entry->Timestamp != last_timestamp)
+                run = &_SrcRuns.Data[run_n];
+                if (!PerfToolIsDateRangeVisible(this, run->Date, run->Date))
+                    continue;
+
+                // Also count how many unique runs participate in this aggregated batch.
+                batch.NumSamples++;
+                for (const ImGuiPerfToolEntry* e = &_SrcData.Data[run->SrcIndex], *e_end = e + run->SrcCount; e < e_end; e++)
                 {
-                    batch.NumSamples++;
-                    last_timestamp = entry->Timestamp;
+                    const int label_index = temp_set.GetInt(e->TestNameID, -1);
+                    if (label_index >= 0)
+                        PerfToolAccumulateEntry(&batch.Entries.Data[label_index], e);
                 }
-                entry++;
             }
+            while (++run_n < _SrcRuns.Size && combine_by_build_info && _SrcRuns.Data[run_n].BuildStressID == build_stress_id);
         }
-        else
+
+        // In case data is combined by build info, DtDeltaMs will be a sum of all combined entries. Average it out.
+        // Hardware counters, CPU times and scaling fits are always averaged, as only some of samples may have them.
+        for (int i = 0; i < num_visible_labels; i++)
         {
-            for (ImU64 timestamp = entry->Timestamp; entry < _SrcData.end() && timestamp == entry->Timestamp;)
-                entry++;
+            ImGuiPerfToolEntry* aggregate = &batch.Entries.Data[i];
+            if (combine_by_build_info && aggregate->NumSamples > 0)
+                aggregate->DtDeltaMs /= aggregate->NumSamples;
+            if (aggregate->NumSamplesWithCounters > 1)
+            {
+                aggregate->Instructions /= aggregate->NumSamplesWithCounters;
+                aggregate->Cycles /= aggregate->NumSamplesWithCounters;
+                aggregate->CacheMisses /= aggregate->NumSamplesWithCounters;
+                aggregate->BranchMisses /= aggregate->NumSamplesWithCounters;
+            }
+            if (aggregate->NumSamplesWithCpuTime > 1)
+            {
+                aggregate->CpuBuildMs /= aggregate->NumSamplesWithCpuTime;
+                aggregate->CpuRenderMs /= aggregate->NumSamplesWithCpuTime;
+            }
+            if (aggregate->NumSamplesWithScaling > 1)
+            {
+                aggregate->ScalingExponent /= aggregate->NumSamplesWithScaling;
+                aggregate->ScalingCostMs /= aggregate->NumSamplesWithScaling;
+            }
         }
     }
 
@@ -711,12 +1028,27 @@ void ImGuiPerfTool::_Rebuild()
         double delta_sum = 0.0;
         double delta_prd = 1.0;
         double delta_rec = 0.0;
+        double cpu_sum[2] = { 0.0, 0.0 };   // CpuBuildMs, CpuRenderMs. Only entries which have CPU time participate.
+        double cpu_prd[2] = { 1.0, 1.0 };
+        double cpu_rec[2] = { 0.0, 0.0 };
+        int cpu_count = 0;
         for (int i = 0; i < batch.Entries.Size; i++)
         {
             ImGuiPerfToolEntry* entry = &batch.Entries.Data[i];
             delta_sum += entry->DtDeltaMs;
             delta_prd *= entry->DtDeltaMs;
             delta_rec += 1 / entry->DtDeltaMs;
+            if (HasCpuTime(entry))
+            {
+                const double cpu_values[2] = { entry->CpuBuildMs, entry->CpuRenderMs };
+                for (int n = 0; n < 2; n++)
+                {
+                    cpu_sum[n] += cpu_values[n];
+                    cpu_prd[n] *= cpu_values[n];
+                    cpu_rec[n] += 1 / cpu_values[n];
+                }
+                cpu_count++;
+            }
         }
 
         int visible_label_i = 0;
@@ -736,15 +1068,36 @@ void ImGuiPerfTool::_Rebuild()
             mean_entry->OS = "";
             mean_entry->Cpu = "";
             mean_entry->Date = "";
+            mean_entry->Instructions = mean_entry->Cycles = mean_entry->CacheMisses = mean_entry->BranchMisses = 0.0;
+            mean_entry->NumSamplesWithCounters = 0;
+            mean_entry->CpuBuildMs = mean_entry->CpuRenderMs = 0.0;
+            mean_entry->NumSamplesWithCpuTime = cpu_count;
+            mean_entry->ScalingPoints = mean_entry->NumSamplesWithScaling = 0;
+            mean_entry->ScalingExponent = mean_entry->ScalingCostMs = 0.0;
+            double* cpu_means[2] = { &mean_entry->CpuBuildMs, &mean_entry->CpuRenderMs };
             visible_label_i++;
             if (i == 0)
+            {
                 mean_entry->DtDeltaMs = num_visible_labels / delta_rec;
+                for (int n = 0; n < 2 && cpu_count > 0; n++)
+                    *cpu_means[n] = cpu_count / cpu_rec[n];
+            }
             else if (i == 1)
+            {
                 mean_entry->DtDeltaMs = delta_sum / num_visible_labels;
+                for (int n = 0; n < 2 && cpu_count > 0; n++)
+                    *cpu_means[n] = cpu_sum[n] / cpu_count;
+            }
             else if (i == 2)
+            {
                 mean_entry->DtDeltaMs = pow(delta_prd, 1.0 / num_visible_labels);
+                for (int n = 0; n < 2 && cpu_count > 0; n++)
+                    *cpu_means[n] = pow(cpu_prd[n], 1.0 / cpu_count);
+            }
             else
+            {
                 IM_ASSERT(0);
+            }
         }
         IM_ASSERT(batch.Entries.Size == _LabelsVisible.Size);
     }
@@ -802,26 +1155,25 @@ void ImGuiPerfTool::_Rebuild()
     }
 
     // When per-branch colors are enabled we aggregate sample counts and set them to all batches with identical build info.
-    temp_set.Data.resize(0);    // build_id:TotalSamples
+    temp_set.Data.resize(0);    // build_stress_id:TotalSamples
     if (_DisplayType == ImGuiPerfToolDisplayType_PerBranchColors)
     {
         // Aggregate totals to temp_set.
         for (ImGuiPerfToolBatch& batch : _Batches)
         {
-            ImGuiID build_id = GetBuildID(&batch);
-            temp_set.SetInt(build_id, temp_set.GetInt(build_id, 0) + batch.NumSamples);
+            ImGuiID build_stress_id = batch.Entries.Data[0].BuildStressID;
+            temp_set.SetInt(build_stress_id, temp_set.GetInt(build_stress_id, 0) + batch.NumSamples);
         }
 
         // Fill in batch sample counts.
         for (ImGuiPerfToolBatch& batch : _Batches)
         {
-            ImGuiID build_id = GetBuildID(&batch);
-            batch.NumSamples = temp_set.GetInt(build_id, 1);
+            ImGuiID build_stress_id = batch.Entries.Data[0].BuildStressID;
+            batch.NumSamples = temp_set.GetInt(build_stress_id, 1);
         }
     }
 
     _NumVisibleBuilds = PerfToolCountBuilds(this, true);
-    _NumUniqueBuilds = PerfToolCountBuilds(this, false);
 
     _CalculateLegendAlignment();
     temp_set.Data.resize(0);
@@ -834,6 +1186,13 @@ void ImGuiPerfTool::Clear()
     _Batches.clear_destruct();
     _Visibility.Clear();
     _SrcData.clear_destruct();
+    _SrcRuns.clear();
+    _SrcBuilds.clear();
+    _SrcBuildAggregates.clear_destruct();
+    _SrcLabels.clear();
+    _SrcStrings.Clear();
+    _SrcDataDirty = false;
+    _NumUniqueBuilds = 0;
     _CsvParser->Clear();
 
     ImStrncpy(_FilterDateFrom, "9999-99-99", IM_COUNTOF(_FilterDateFrom));
@@ -848,7 +1207,8 @@ bool ImGuiPerfTool::LoadCSV(const char* filename)
     Clear();
 
     ImGuiCsvParser* parser = _CsvParser;
-    parser->Columns = 11;
+    parser->Columns = 20;
+    parser->ColumnsMin = 11;    // Older perflogs have no hardware counters, CPU time or scaling columns.
     if (!parser->Load(filename))
         return false;
 
@@ -868,6 +1228,15 @@ bool ImGuiPerfTool::LoadCSV(const char* filename)
         entry.OS = parser->GetCell(row, col++);
         entry.Compiler = parser->GetCell(row, col++);
         entry.Date = parser->GetCell(row, col++);
+        sscanf(parser->GetCell(row, col++), "%lf", &entry.Instructions);
+        sscanf(parser->GetCell(row, col++), "%lf", &entry.Cycles);
+        sscanf(parser->GetCell(row, col++), "%lf", &entry.CacheMisses);
+        sscanf(parser->GetCell(row, col++), "%lf", &entry.BranchMisses);
+        sscanf(parser->GetCell(row, col++), "%lf", &entry.CpuBuildMs);
+        sscanf(parser->GetCell(row, col++), "%lf", &entry.CpuRenderMs);
+        sscanf(parser->GetCell(row, col++), "%d", &entry.ScalingPoints);
+        sscanf(parser->GetCell(row, col++), "%lf", &entry.ScalingExponent);
+        sscanf(parser->GetCell(row, col++), "%lf", &entry.ScalingCostMs);
         AddEntry(&entry);
     }
 
@@ -1042,6 +1411,14 @@ bool ImGuiPerfTool::SaveHtmlReport(const char* file_name, const char* image_file
                 case 10: fprintf(fp, "| %.2f ", entry->DtDeltaMsMax);       break;
                 case 11: fprintf(fp, "| %d ", entry->NumSamples);           break;
                 case 12: FormatVsBaseline(entry, baseline_entry, label); fprintf(fp, "| %s ", label.c_str()); break;
+                case 13: FormatPerfCounter(entry, entry->Instructions, label); fprintf(fp, "| %s ", label.c_str()); break;
+                case 14: FormatPerfCounter(entry, entry->Cycles, label);       fprintf(fp, "| %s ", label.c_str()); break;
+                case 15: FormatPerfCounter(entry, entry->CacheMisses, label);  fprintf(fp, "| %s ", label.c_str()); break;
+                case 16: FormatPerfCounter(entry, entry->BranchMisses, label); fprintf(fp, "| %s ", label.c_str()); break;
+                case 17: FormatCpuTime(entry, entry->CpuBuildMs, label);       fprintf(fp, "| %s ", label.c_str()); break;
+                case 18: FormatCpuTime(entry, entry->CpuRenderMs, label);      fprintf(fp, "| %s ", label.c_str()); break;
+                case 19: FormatScaling(entry, baseline_entry, label);          fprintf(fp, "| %s ", label.c_str()); break;
+                case 20: if (HasScaling(entry)) fprintf(fp, "| %.4f ", entry->ScalingCostMs); else fprintf(fp, "| -- "); break;
                 default: IM_ASSERT(0); break;
                 }
             }
@@ -1136,19 +1513,19 @@ void ImGuiPerfTool::ShowPerfToolWindow(ImGuiTestEngine* engine, bool* p_open)
             int date_size = i == 0 ? IM_COUNTOF(_FilterDateFrom) : IM_COUNTOF(_FilterDateTo);
             if (i == 0 && ImGui::MenuItem("Set Min"))
             {
-                for (ImGuiPerfToolEntry& entry : _SrcData)
-                    if (strcmp(date, entry.Date) > 0)
+                for (ImGuiPerfToolRun& run : _SrcRuns)
+                    if (strcmp(date, run.Date) > 0)
                     {
-                        ImStrncpy(date, entry.Date, date_size);
+                        ImStrncpy(date, run.Date, date_size);
                         dirty = true;
                     }
             }
             if (ImGui::MenuItem("Set Max"))
             {
-                for (ImGuiPerfToolEntry& entry : _SrcData)
-                    if (strcmp(date, entry.Date) < 0)
+                for (ImGuiPerfToolRun& run : _SrcRuns)
+                    if (strcmp(date, run.Date) < 0)
                     {
-                        ImStrncpy(date, entry.Date, date_size);
+                        ImStrncpy(date, run.Date, date_size);
                         dirty = true;
                     }
             }
@@ -1188,6 +1565,16 @@ void ImGuiPerfTool::ShowPerfToolWindow(ImGuiTestEngine* engine, bool* p_open)
     ImGui::Combo("##report", (int*)&_ReportType, "Details\0Batches\0");
     ImGui::SetItemTooltip("Details: Show tests and batches as rows, details in columns.\nBatches: Show test as rows, batches in columns.");
 
+    ImGui::SameLine();
+    ImGui::SetNextItemWidth(ImGui::GetFrameHeight() * 6.0f);
+    if (ImGui::Combo("##metric", (int*)&_PlotMetric, "Frame time\0CPU Build\0CPU Render\0"))
+    {
+#if IMGUI_TEST_ENGINE_ENABLE_IMPLOT
+        ImPlot::SetNextAxesToFit();
+#endif
+    }
+    ImGui::SetItemTooltip("Value plotted in the chart.\nFrame time: Frame delta time vs reference.\nCPU Build: Main thread CPU time of NewFrame->Render.\nCPU Render: Main thread CPU time of Render->PreSwap.\n\nCPU times are only recorded when running tests with ConfigPerfCpuTime enabled.");
+
     ImGui::SameLine();
     if (_ReportGenerating && ImGuiTestEngine_IsTestQueueEmpty(engine))
     {
@@ -1241,9 +1628,11 @@ void ImGuiPerfTool::ShowPerfToolWindow(ImGuiTestEngine* engine, bool* p_open)
             ImGui::TableHeadersRow();
 
             // Find columns with nothing checked.
+            // Build properties are identical for all entries of a run, so we only need to look at first entry of each run.
             bool checked_any[] = { false, false, false, false, false };
-            for (ImGuiPerfToolEntry& entry : _SrcData)
+            for (ImGuiPerfToolRun& run : _SrcRuns)
             {
+                ImGuiPerfToolEntry& entry = _SrcData[run.SrcIndex];
                 const char* properties[] = { entry.GitBranchName, entry.BuildType, entry.Cpu, entry.OS, entry.Compiler };
                 for (int i = 0; i < IM_COUNTOF(properties); i++)
                 {
@@ -1265,8 +1654,9 @@ void ImGuiPerfTool::ShowPerfToolWindow(ImGuiTestEngine* engine, bool* p_open)
             for (int i = 0; i < IM_COUNTOF(property_offsets); i++)
             {
                 ImGui::TableSetColumnIndex(i);
-                for (ImGuiPerfToolEntry& entry : _SrcData)
+                for (ImGuiPerfToolRun& run : _SrcRuns)
                 {
+                    ImGuiPerfToolEntry& entry = _SrcData[run.SrcIndex];
                     const char* property = *(const char**)((const char*)&entry + property_offsets[i]);
                     ImGuiID hash = ImHashStr(property);
                     if (temp_set.GetBool(hash))
@@ -1414,7 +1804,7 @@ void ImGuiPerfTool::_ShowEntriesPlot()
         if (_DisplayType == ImGuiPerfToolDisplayType_PerBranchColors)
         {
             // No "vs baseline" comparison for per-branch colors, because runs are combined in the legend, but not in the info table.
-            batch_label_id = GetBuildID(&batch);
+            batch_label_id = batch.Entries.Data[0].BuildStressID;
         }
         else
         {
@@ -1433,13 +1823,14 @@ void ImGuiPerfTool::_ShowEntriesPlot()
             const int now_visible_builds = temp_set.GetInt(label_id);
             temp_set.SetInt(label_id, now_visible_builds + 1);
             double y_pos = (double)entry.LabelIndex + GetLabelVerticalOffset(occupy_h, max_visible_builds, now_visible_builds);
+            double x_value = PerfToolGetPlotValue(&entry, _PlotMetric);
 #if IMPLOT_VERSION_NUM >= 1800
             ImPlotSpec plot_spec;
             plot_spec.Flags = ImPlotBarsFlags_Horizontal;
-            ImPlot::PlotBars<double>(display_label.c_str(), &entry.DtDeltaMs, &y_pos, 1, occupy_h / (double)max_visible_builds, plot_spec);
+            ImPlot::PlotBars<double>(display_label.c_str(), &x_value, &y_pos, 1, occupy_h / (double)max_visible_builds, plot_spec);
 #else
             ImPlot::SetNextFillStyle(ImPlot::GetColormapColor(_DisplayType == ImGuiPerfToolDisplayType_PerBranchColors ? batch.BranchIndex : batch_index));
-            ImPlot::PlotBars<double>(display_label.c_str(), &entry.DtDeltaMs, &y_pos, 1, occupy_h / (double)max_visible_builds, ImPlotBarsFlags_Horizontal);
+            ImPlot::PlotBars<double>(display_label.c_str(), &x_value, &y_pos, 1, occupy_h / (double)max_visible_builds, ImPlotBarsFlags_Horizontal);
 #endif
         }
         legend_hovered |= ImPlot::IsLegendEntryHovered(display_label.c_str());
@@ -1557,7 +1948,7 @@ void ImGuiPerfTool::_ShowEntriesPlot()
         for (int i = 0; i < _Batches.Size; i++)
         {
             if (ImGuiPerfToolEntry* hovered_entry = GetEntryByBatchIdx(i, test_name))
-                ImGui::Text("%s %.3fms", label.c_str(), hovered_entry->DtDeltaMs);
+                ImGui::Text("%s %.3fms", label.c_str(), PerfToolGetPlotValue(hovered_entry, _PlotMetric));
             else
                 ImGui::Text("%s --", label.c_str());
         }
@@ -1741,6 +2132,48 @@ void ImGuiPerfTool::_ShowEntriesTable()
             }
         }
 
+        // Hardware performance counters
+        const double perf_counters[] = { entry->Instructions, entry->Cycles, entry->CacheMisses, entry->BranchMisses };
+        for (double perf_counter : perf_counters)
+            if (ImGui::TableNextColumn())
+            {
+                if (HasPerfCounters(entry))
+                    ImGui::Text("%.0f", perf_counter);
+                else
+                    ImGui::TextUnformatted("--");
+            }
+
+        // Main thread CPU time
+        const double cpu_times[] = { entry->CpuBuildMs, entry->CpuRenderMs };
+        for (double cpu_time : cpu_times)
+            if (ImGui::TableNextColumn())
+            {
+                if (HasCpuTime(entry))
+                    ImGui::Text("%.3lf", cpu_time);
+                else
+                    ImGui::TextUnformatted("--");
+            }
+
+        // Scaling fit
+        if (ImGui::TableNextColumn())
+        {
+            Str30 label;
+            FormatScaling(entry, baseline_entry, label);
+            ImGui::TextUnformatted(label.c_str());
+            if (IsScalingRegression(entry, baseline_entry))
+            {
+                ImGui::TableSetBgColor(ImGuiTableBgTarget_CellBg, ImColor(1.0f, 0.0f, 0.0f, 0.2f));
+                ImGui::SetItemTooltip("Scaling exponent increased by %.2f vs baseline: cost grows faster with stress amount.", entry->ScalingExponent - baseline_entry->ScalingExponent);
+            }
+        }
+        if (ImGui::TableNextColumn())
+        {
+            if (HasScaling(entry))
+                ImGui::Text("%.4lf", entry->ScalingCostMs);
+            else
+                ImGui::TextUnformatted("--");
+        }
+
         if (_PlotHoverTest == entry_index_sorted && scroll_into_view)
         {
             ImGuiTable* table = ImGui::GetCurrentTable();
@@ -1961,6 +2394,20 @@ void ImGuiPerfTool::_ShowEntriesTableBatches()
                 ImGui::Text("Min: %.3lf ms", entry->DtDeltaMsMin);
                 ImGui::Text("Max: %.3lf ms", entry->DtDeltaMsMax);
                 ImGui::Text("Samples: %d", entry->NumSamples);
+                if (HasPerfCounters(entry))
+                {
+                    ImGui::Text("Instructions: %.0f/frame", entry->Instructions);
+                    ImGui::Text("Cycles: %.0f/frame", entry->Cycles);
+                    ImGui::Text("Cache misses: %.0f/frame", entry->CacheMisses);
+                    ImGui::Text("Branch misses: %.0f/frame", entry->BranchMisses);
+                }
+                if (HasCpuTime(entry))
+                {
+                    ImGui::Text("CPU NewFrame->Render: %.3lf ms", entry->CpuBuildMs);
+                    ImGui::Text("CPU Render->PreSwap: %.3lf ms", entry->CpuRenderMs);
+                }
+                if (HasScaling(entry))
+                    ImGui::Text("Scaling: exponent %.2f, %.4f ms/stress (%d points)", entry->ScalingExponent, entry->ScalingCostMs, entry->ScalingPoints);
                 ImGui::EndTooltip();
             }
 
@@ -2065,11 +2512,12 @@ static void PerflogSettingsHandler_ReadLine(ImGuiContext*, ImGuiSettingsHandler*
 {
     ImGuiPerfTool* perftool = (ImGuiPerfTool*)ini_handler->UserData;
     char buf[128];
-    int visible = -1, display_type = -1, report_type = -1;
+    int visible = -1, display_type = -1, report_type = -1, plot_metric = -1;
     /**/ if (sscanf(line, "DateFrom=%10s", perftool->_FilterDateFrom)) {}
     else if (sscanf(line, "DateTo=%10s", perftool->_FilterDateTo)) {}
     else if (sscanf(line, "DisplayType=%d", &display_type)) { perftool->_DisplayType = (ImGuiPerfToolDisplayType)display_type; }
     else if (sscanf(line, "ReportType=%d", &report_type)) { perftool->_ReportType = (ImGuiPerfToolReportType)report_type; }
+    else if (sscanf(line, "PlotMetric=%d", &plot_metric)) { if (plot_metric >= 0 && plot_metric < ImGuiPerfToolPlotMetric_COUNT) perftool->_PlotMetric = (ImGuiPerfToolPlotMetric)plot_metric; }
     else if (sscanf(line, "BaselineBuildId=%llu", &perftool->_BaselineBuildId)) {}
     else if (sscanf(line, "BaselineTimestamp=%llu", &perftool->_BaselineTimestamp)) {}
     else if (sscanf(line, "BaselineTestName=%s", perftool->_BaselineTestName)) {}
@@ -2094,6 +2542,7 @@ static void PerflogSettingsHandler_WriteAll(ImGuiContext*, ImGuiSettingsHandler*
     buf->appendf("DateTo=%s\n", perftool->_FilterDateTo);
     buf->appendf("DisplayType=%d\n", perftool->_DisplayType);
     buf->appendf("ReportType=%d\n", perftool->_ReportType);
+    buf->appendf("PlotMetric=%d\n", perftool->_PlotMetric);
     buf->appendf("BaselineBuildId=%llu\n", perftool->_BaselineBuildId);
     buf->appendf("BaselineTimestamp=%llu\n", perftool->_BaselineTimestamp);
     buf->appendf("BaselineTestName=%s\n", perftool->_BaselineTestName);
@@ -2102,8 +2551,9 @@ static void PerflogSettingsHandler_WriteAll(ImGuiContext*, ImGuiSettingsHandler*
 
     ImGuiStorage& temp_set = perftool->_TempSet;
     temp_set.Data.clear();
-    for (ImGuiPerfToolEntry& entry : perftool->_SrcData)
+    for (ImGuiPerfToolRun& run : perftool->_SrcRuns)
     {
+        ImGuiPerfToolEntry& entry = perftool->_SrcData[run.SrcIndex];
         const char* properties[] = { entry.GitBranchName, entry.BuildType, entry.Cpu, entry.OS, entry.Compiler };
         for (int i = 0; i < IM_COUNTOF(properties); i++)
         {
@@ -38,14 +38,29 @@ struct IMGUI_API ImGuiPerfToolEntry
     const char*                 OS = nullptr;                   // e.g. "Windows"
     const char*                 Compiler = nullptr;             // e.g. "MSVC"
     const char*                 Date = nullptr;                 // e.g. "2026-01-01". Date of this entry or min date of combined entries.
+    double                      Instructions = 0.0;             // Hardware performance counters, mean per frame. 0.0 when not captured (see ImGuiTestEngineIO::ConfigPerfCounters).
+    double                      Cycles = 0.0;                   //
+    double                      CacheMisses = 0.0;              //
+    double                      BranchMisses = 0.0;             //
+    double                      CpuBuildMs = 0.0;               // Main thread CPU time of NewFrame->Render phase, mean per frame. 0.0 when not captured (see ImGuiTestEngineIO::ConfigPerfCpuTime).
+    double                      CpuRenderMs = 0.0;              // Main thread CPU time of Render->PreSwap phase, mean per frame.
+    int                         ScalingPoints = 0;              // Number of stress amounts fitted. 0 when entry is not the last step of a stress amount sweep (see ImGuiTestEngineIO::PerfStressSweepSteps).
+    double                      ScalingExponent = 0.0;          // Empirical complexity exponent k, fit of DtDeltaMs ~ PerfStressAmount^k. ~1.0 for linear, ~2.0 for quadratic.
+    double                      ScalingCostMs = 0.0;            // Cost per unit of PerfStressAmount (ms), slope of linear fit.
 
     // Runtime data
     double                      DtDeltaMsMin = +FLT_MAX;        // May be used by perftool.
     double                      DtDeltaMsMax = -FLT_MAX;        // May be used by perftool.
     int                         NumSamples = 1;                 // Number aggregated samples.
+    int                         NumSamplesWithCounters = 0;     // Number aggregated samples with hardware performance counters.
+    int                         NumSamplesWithCpuTime = 0;      // Number aggregated samples with CPU time.
+    int                         NumSamplesWithScaling = 0;      // Number aggregated samples with scaling fit.
     //const char*               DateMax = nullptr;              // Max date of combined entries, or nullptr.
     double                      VsBaseline = 0.0;               // Percent difference vs baseline.
     int                         LabelIndex = 0;                 // Index of TestName in ImGuiPerfTool::_LabelsVisible.
+    ImGuiID                     TestNameID = 0;                 // Unique key of interned TestName (ImHashStr(TestName) unless colliding), calculated by ImGuiPerfTool::AddEntry().
+    ImGuiID                     BuildID = 0;                    // Hash of build info (BuildType, OS, Cpu, Compiler, GitBranchName), calculated by ImGuiPerfTool::AddEntry().
+    ImGuiID                     BuildStressID = 0;              // Hash of BuildID and PerfStressAmount, calculated by ImGuiPerfTool::AddEntry(). Entries are grouped by this key: results at different stress amounts are never combined.
 
     ImGuiPerfToolEntry()        { }
     ImGuiPerfToolEntry(const ImGuiPerfToolEntry& rhs)           { Set(rhs); }
@@ -53,6 +68,30 @@ struct IMGUI_API ImGuiPerfToolEntry
     void Set(const ImGuiPerfToolEntry& rhs);
 };
 
+// [Internal] Index over sorted ImGuiPerfTool::_SrcData: a contiguous range of entries sharing same build info and timestamp.
+// Those are pre-sorted and pre-grouped once when new data is added, so changing filters or display type only needs to walk runs.
+struct ImGuiPerfToolRun
+{
+    int                         SrcIndex = 0;                   // Index of first entry in _SrcData.
+    int                         SrcCount = 0;                   // Number of entries in _SrcData.
+    ImU64                       Timestamp = 0;
+    ImGuiID                     BuildStressID = 0;
+    const char*                 Date = nullptr;
+    int                         BuildIndex = 0;                 // Index of build in _SrcBuilds.
+};
+
+// [Internal] Index over ImGuiPerfTool::_SrcRuns: consecutive runs sharing same build info, with their entries pre-aggregated per test.
+// When combining by build info, a build which has none of its runs filtered out is added to a batch without walking its entries.
+struct ImGuiPerfToolBuild
+{
+    int                         RunIndex = 0;                   // Index of first run in _SrcRuns.
+    int                         RunCount = 0;                   // Number of runs in _SrcRuns.
+    int                         AggregateIndex = 0;             // Index of first aggregate in _SrcBuildAggregates. One per test, sums are not averaged.
+    int                         AggregateCount = 0;             // Number of aggregates in _SrcBuildAggregates.
+    const char*                 DateMin = nullptr;
+    const char*                 DateMax = nullptr;
+};
+
 // [Internal] Perf log batch.
 struct ImGuiPerfToolBatch
 {
@@ -76,10 +115,24 @@ enum ImGuiPerfToolReportType : int
     ImGuiPerfToolReportType_Batches,                            // Show test as rows, batches in columns.
 };
 
+enum ImGuiPerfToolPlotMetric : int
+{
+    ImGuiPerfToolPlotMetric_DtDelta,                            // Plot frame time delta vs reference (ImGuiPerfToolEntry::DtDeltaMs).
+    ImGuiPerfToolPlotMetric_CpuBuild,                           // Plot CPU time of NewFrame->Render phase (ImGuiPerfToolEntry::CpuBuildMs).
+    ImGuiPerfToolPlotMetric_CpuRender,                          // Plot CPU time of Render->PreSwap phase (ImGuiPerfToolEntry::CpuRenderMs).
+    ImGuiPerfToolPlotMetric_COUNT
+};
+
 //
 struct IMGUI_API ImGuiPerfTool
 {
     ImVector<ImGuiPerfToolEntry>_SrcData;                       // Raw entries from CSV file (with string pointer into CSV data).
+    ImVector<ImGuiPerfToolRun>  _SrcRuns;                       // Index of runs in sorted _SrcData. Updated by _RebuildIndex().
+    ImVector<const char*>       _SrcLabels;                     // Unique test names in _SrcData, sorted in reverse order. Updated by _RebuildIndex().
+    ImVector<ImGuiPerfToolBuild> _SrcBuilds;                    // Index of builds in _SrcRuns. Updated by _RebuildIndex().
+    ImVector<ImGuiPerfToolEntry> _SrcBuildAggregates;           // Entries of each build aggregated per test. Updated by _RebuildIndex().
+    ImGuiStorage                _SrcStrings;                    // Interned strings: ImHashStr(str) -> const char*, colliding strings use next free key. Equal strings in _SrcData share a same pointer.
+    bool                        _SrcDataDirty = false;          // Set when entries were added and _SrcData needs to be sorted/indexed again.
     ImVector<const char*>       _Labels;
     ImVector<const char*>       _LabelsVisible;                 // ImPlot requires a pointer of all labels beforehand. Always contains a dummy "" entry at the end!
     ImVector<ImGuiPerfToolBatch> _Batches;
@@ -88,6 +141,7 @@ struct IMGUI_API ImGuiPerfTool
     int                         _NumUniqueBuilds = 0;           // Cached number of unique builds.
     ImGuiPerfToolDisplayType    _DisplayType = ImGuiPerfToolDisplayType_CombineByBuildInfo;
     ImGuiPerfToolReportType     _ReportType = ImGuiPerfToolReportType_Details;
+    ImGuiPerfToolPlotMetric     _PlotMetric = ImGuiPerfToolPlotMetric_DtDelta;
     int                         _BaselineBatchIndex = 0;        // Index of baseline build.
     int                         _BaselineTestIndex = -1;        // Index of baseline test.
     ImU64                       _BaselineTimestamp = 0;
@@ -132,6 +186,8 @@ struct IMGUI_API ImGuiPerfTool
     inline bool Empty()         { return _SrcData.empty(); }
 
     void        _Rebuild();
+    void        _RebuildIndex();
+    const char* _InternString(const char* str, ImGuiID* out_id = nullptr);
     bool        _IsVisibleBuild(ImGuiPerfToolBatch* batch);
     bool        _IsVisibleBuild(ImGuiPerfToolEntry* batch);
     bool        _IsVisibleTest(const char* test_name);
@@ -145,3 +201,4 @@ struct IMGUI_API ImGuiPerfTool
 };
 
 IMGUI_API void    ImGuiTestEngine_PerfToolAppendToCSV(ImGuiPerfToolEntry* entry, const char* filename = nullptr);
+IMGUI_API bool    ImGuiTestEngine_PerfToolFitScaling(const int* stress_amounts, const double* dt_deltas_ms, int count, double* out_exponent, double* out_cost_ms);
@@ -137,33 +137,22 @@ static void DrawTestLog(ImGuiTestEngine* e, ImGuiTest* test)
     ImGuiTestOutput* test_output = &test->Output;
 
     ImGuiTestLog* log = &test_output->Log;
-    const char* text = log->Buffer.begin();
-    const char* text_end = log->Buffer.end();
     ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(6.0f, 2.0f) * dpi_scale);
     ImGuiListClipper clipper;
     ImGuiTestVerboseLevel max_log_level = test_output->Status == ImGuiTestStatus_Error ? e->IO.ConfigVerboseLevelOnError : e->IO.ConfigVerboseLevel;
     int line_count = log->ExtractLinesForVerboseLevels(ImGuiTestVerboseLevel_Silent, max_log_level, nullptr);
-    int current_index_clipped = -1;
-    int current_index_abs = 0;
     clipper.Begin(line_count);
     while (clipper.Step())
     {
         for (int line_no = clipper.DisplayStart; line_no < clipper.DisplayEnd; line_no++)
         {
-            // Advance index_by_log_level to find log entry indicated by line_no.
-            ImGuiTestLogLineInfo* line_info = nullptr;
-            while (current_index_clipped < line_no)
-            {
-                line_info = &log->LineInfo[current_index_abs];
-                if (line_info->Level <= max_log_level)
-                    current_index_clipped++;
-                current_index_abs++;
-            }
-
-            const char* line_start = text + line_info->LineOffset;
-            const char* line_end = strchr(line_start, '\n');
-            if (line_end == nullptr)
-                line_end = text_end;
+            // Seek log entry indicated by line_no (doesn't scan from start, as filtered out lines may be sparse)
+            const int line_idx = log->FindLineIndexForVerboseLevels(ImGuiTestVerboseLevel_Silent, max_log_level, line_no);
+            if (line_idx == -1)
+                break;
+            ImGuiTestLogLineInfo* line_info = &log->LineInfo[line_idx];
+            const char* line_start = log->GetLineBegin(line_idx);
+            const char* line_end = log->GetLineEnd(line_idx);
 
             switch (line_info->Level)
             {
@@ -571,17 +560,12 @@ static void ShowTestGroup(ImGuiTestEngine* e, ImGuiTestGroup group, Str* filter,
             }
 
             // Process source popup
-            static ImGuiTextBuffer source_blurb;
+            // (source files are cached and shared by all tests, only visible lines are submitted)
+            static ImSourceFile* source_file = nullptr;
             static int goto_line = -1;
             if (view_source)
             {
-                source_blurb.clear();
-                size_t file_size = 0;
-                char* file_data = (char*)ImFileLoadToMemory(test->SourceFile, "rb", &file_size);
-                if (file_data)
-                    source_blurb.append(file_data, file_data + file_size);
-                else
-                    source_blurb.append("<Error loading sources>");
+                source_file = e->SourceFiles.GetOrLoad(test->SourceFile);
                 goto_line = test->SourceLine;
                 ImGui::OpenPopup("Source");
             }
@@ -596,7 +580,25 @@ static void ShowTestGroup(ImGuiTestEngine* e, ImGuiTestGroup group, Str* filter,
                 ImRect r(0.0f, (test->SourceLine - 1) * line_height, ImGui::GetWindowWidth(), (test->SourceLineEnd - 1) * line_height);
                 ImGui::GetWindowDrawList()->AddRectFilled(start_pos + r.Min, start_pos + r.Max, IM_COL32(80, 80, 150, 100));
 
-                ImGui::TextUnformatted(source_blurb.c_str(), source_blurb.end());
+                if (source_file != nullptr)
+                {
+                    ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(ImGui::GetStyle().ItemSpacing.x, 0.0f));
+                    ImGuiListClipper clipper;
+                    clipper.Begin(source_file->GetLineCount(), line_height);
+                    while (clipper.Step())
+                        for (int line_no = clipper.DisplayStart + 1; line_no <= clipper.DisplayEnd; line_no++)
+                        {
+                            const char* line_begin;
+                            const char* line_end;
+                            source_file->GetLines(line_no, line_no, &line_begin, &line_end);
+                            ImGui::TextUnformatted(line_begin, line_end);
+                        }
+                    ImGui::PopStyleVar();
+                }
+                else
+                {
+                    ImGui::TextUnformatted("<Error loading sources>");
+                }
                 ImGui::EndPopup();
             }
 
@@ -686,6 +688,54 @@ static void ImGuiTestEngine_ShowLogAndTools(ImGuiTestEngine* engine)
         ImGui::EndTabItem();
     }
 
+    // Search in all logs
+    if (ImGui::BeginTabItem("SEARCH"))
+    {
+        ImGui::SetNextItemWidth(-FLT_MIN);
+        ImGui::InputTextWithHint("##search", "Search in all test logs (text, 0x IDs...)", engine->UiLogSearch);
+
+        // Update results when query changed or logs changed
+        int line_count = 0;
+        for (ImGuiTest* test : engine->TestsAll)
+            line_count += test->Output.Log.LineInfo.Size;
+        const ImGuiID search_hash = ImHashStr(engine->UiLogSearch->c_str());
+        if (search_hash != engine->UiLogSearchHash || line_count != engine->UiLogSearchLineCount)
+        {
+            engine->UiLogSearchHash = search_hash;
+            engine->UiLogSearchLineCount = line_count;
+            engine->UiLogSearchResults.resize(0);
+            ImGuiTestEngine_SearchLogs(engine, engine->UiLogSearch->c_str(), &engine->UiLogSearchResults);
+        }
+        ImGui::Text("%d matches", engine->UiLogSearchResults.Size);
+        ImGui::Separator();
+
+        ImGui::BeginChild("Results");
+        ImGuiListClipper clipper;
+        clipper.Begin(engine->UiLogSearchResults.Size);
+        while (clipper.Step())
+            for (int result_n = clipper.DisplayStart; result_n < clipper.DisplayEnd; result_n++)
+            {
+                ImGuiTestLogSearchResult& result = engine->UiLogSearchResults[result_n];
+                ImGuiTestLog* log = &result.Test->Output.Log;
+                ImGui::PushID(result_n);
+                Str256f test_label("%s:%d", result.Test->Name, result.LineIdx + 1);
+                if (ImGui::Selectable(test_label.c_str(), engine->UiSelectedTest == result.Test, ImGuiSelectableFlags_None, ImVec2(ImGui::GetFontSize() * 16, 0.0f)))
+                {
+                    engine->UiSelectedTest = result.Test;
+                    engine->UiSelectAndScrollToTest = result.Test;
+                }
+                ImGui::SameLine();
+#if IMGUI_VERSION_NUM >= 19072
+                ImGui::DebugTextUnformattedWithLocateItem(log->GetLineBegin(result.LineIdx), log->GetLineEnd(result.LineIdx));
+#else
+                ImGui::TextUnformatted(log->GetLineBegin(result.LineIdx), log->GetLineEnd(result.LineIdx));
+#endif
+                ImGui::PopID();
+            }
+        ImGui::EndChild();
+        ImGui::EndTabItem();
+    }
+
     // Options
     if (ImGui::BeginTabItem("OPTIONS"))
     {
@@ -850,6 +900,15 @@ static void ImGuiTestEngine_ShowTestTool(ImGuiTestEngine* engine, bool* p_open)
             ImGui::Separator();
             ImGui::MenuItem("Capture Tool", "", &engine->UiCaptureToolOpen);
             ImGui::MenuItem("Perf Tool", "", &engine->UiPerfToolOpen);
+            ImGui::Separator();
+            if (ImGui::MenuItem("Record Inputs", "", ImGuiTestEngine_IsInputRecording(engine)))
+            {
+                if (ImGuiTestEngine_IsInputRecording(engine))
+                    ImGuiTestEngine_InputRecordEnd(engine);
+                else
+                    ImGuiTestEngine_InputRecordBegin(engine);
+            }
+            ImGui::SetItemTooltip("Record inputs submitted by backend, to be replayed in a test with ctx->InputReplay().\nSaved to '%s' when stopping.", IMGUI_TEST_ENGINE_INPUT_RECORDING_DEFAULT_FILENAME);
             ImGui::EndMenu();
         }
         ImGui::EndMenuBar();
@@ -863,13 +922,16 @@ static void ImGuiTestEngine_ShowTestTool(ImGuiTestEngine* engine, bool* p_open)
             for (ImGuiTestRunSpeed level = (ImGuiTestRunSpeed)0; level < ImGuiTestRunSpeed_COUNT; level = (ImGuiTestRunSpeed)(level + 1))
                 if (ImGui::Selectable(ImGuiTestEngine_GetRunSpeedName(level), engine->IO.ConfigRunSpeed == level))
                     engine->IO.ConfigRunSpeed = level;
+            ImGui::Separator();
+            ImGui::MenuItem("Virtual Time", nullptr, &engine->IO.ConfigVirtualTime);
             ImGui::EndCombo();
         }
         ImGui::SetItemTooltip(
             "Running speed\n"
             "- Fast: Run tests as fast as possible (no delay/vsync, teleport mouse, etc.).\n"
             "- Normal: Run tests at human watchable speed (for debugging).\n"
-            "- Cinematic: Run tests with pauses between actions (for e.g. tutorials)."
+            "- Cinematic: Run tests with pauses between actions (for e.g. tutorials).\n"
+            "- Virtual Time: Use simulated clock, so Normal/Cinematic runs are not waiting on wall clock time."
         );
     }
     ImGui::SameLine();
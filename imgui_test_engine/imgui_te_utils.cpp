@@ -23,6 +23,7 @@
 #include <stdio.h>
 #else
 #include <errno.h>
+#include <time.h>       // clock_gettime()
 #include <unistd.h>
 #endif
 #ifndef _MSC_VER
@@ -37,6 +38,22 @@
 #if defined(__linux) || defined(__linux__) || defined(__MACH__) || defined(__MSL__) || defined(__MINGW32__)
 #include <pthread.h>    // pthread_setname_np()
 #endif
+#if defined(__linux) || defined(__linux__)
+#include <linux/perf_event.h>   // perf_event_attr
+#include <sys/syscall.h>        // __NR_perf_event_open
+#endif
+#if defined(__x86_64__) || defined(_M_X64)
+#include <emmintrin.h>          // SSE2: _mm_cmpeq_epi8(), _mm_movemask_epi8()
+#include <nmmintrin.h>          // SSE4.2: _mm_crc32_u64(), _mm_crc32_u8()
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>             // __cpuid(), _BitScanForward()
+#endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>           // vceqq_u8()
+#if defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>           // __crc32cd(), __crc32cb()
+#endif
+#endif
 #include <chrono>       // high_resolution_clock::now()
 #include <thread>       // this_thread::sleep_for()
 
@@ -54,6 +71,8 @@
 //-----------------------------------------------------------------------------
 // Hashing Helpers
 //-----------------------------------------------------------------------------
+// - ImHashDecoratedPathCrc32() [internal]
+// - ImHashDecoratedPathFindSpecialChar() [internal]
 // - ImHashDecoratedPathParseLiteral() [internal]
 // - ImHashDecoratedPath()
 // - ImFindNextDecoratedPartInPath()
@@ -128,12 +147,7 @@ static ImGuiID ImHashDecoratedPathParseLiteral(ImGuiID crc, const unsigned char*
     return crc;
 }
 
-// Hash "hello/world" as if it was "helloworld"
-// To hash a forward slash we need to use "hello\\/world"
-//   IM_ASSERT(ImHashDecoratedPath("Hello/world")   == ImHashStr("Helloworld", 0));
-//   IM_ASSERT(ImHashDecoratedPath("Hello\\/world") == ImHashStr("Hello/world", 0));
-//   IM_ASSERT(ImHashDecoratedPath("$$1")           == (n = 1, ImHashData(&n, sizeof(int))));
-// Adapted from ImHash(). Not particularly fast!
+// CRC32 lookup table, same as the one used by ImHashStr()/ImHashData()
 static const ImU32 GImGuiTestEngineCrc32LookupTable[256] =
 {
 #if (IMGUI_VERSION_NUM < 19152) || defined(IMGUI_USE_LEGACY_CRC32_ADLER)
@@ -173,6 +187,135 @@ static const ImU32 GImGuiTestEngineCrc32LookupTable[256] =
 #endif
 };
 
+// Plain runs of a path are hashed in bulk. When the lookup table is CRC32C (Castagnoli polynomial, Dear ImGui 1.91.5+)
+// we can use SSE4.2 (detected at runtime) or ARMv8 CRC32 instructions (detected at compile time), which are bit-identical.
+#if (IMGUI_VERSION_NUM >= 19152) && !defined(IMGUI_USE_LEGACY_CRC32_ADLER) && !defined(IMGUI_TEST_ENGINE_DISABLE_HASH_ACCELERATION)
+#if defined(__x86_64__) || defined(_M_X64)
+#define IMGUI_TEST_ENGINE_HASH_CRC32C_SSE42
+#elif (defined(__aarch64__) || defined(_M_ARM64)) && defined(__ARM_FEATURE_CRC32)
+#define IMGUI_TEST_ENGINE_HASH_CRC32C_ARM
+#endif
+#endif
+#if !defined(IMGUI_TEST_ENGINE_DISABLE_HASH_ACCELERATION)
+#if defined(__x86_64__) || defined(_M_X64)
+#define IMGUI_TEST_ENGINE_HASH_SCAN_SSE2
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define IMGUI_TEST_ENGINE_HASH_SCAN_NEON
+#endif
+#endif
+
+#ifdef IMGUI_TEST_ENGINE_HASH_CRC32C_SSE42
+#if defined(__GNUC__) || defined(__clang__)
+__attribute__((target("sse4.2")))
+#endif
+static ImU32 ImHashDecoratedPathCrc32_SSE42(ImU32 crc, const unsigned char* data, size_t data_size)
+{
+    ImU64 crc64 = crc;
+    for (; data_size >= 8; data += 8, data_size -= 8)
+    {
+        ImU64 v;
+        memcpy(&v, data, 8);
+        crc64 = _mm_crc32_u64(crc64, v);
+    }
+    crc = (ImU32)crc64;
+    for (; data_size > 0; data++, data_size--)
+        crc = _mm_crc32_u8(crc, *data);
+    return crc;
+}
+
+static bool ImHashDecoratedPathHasSSE42()
+{
+#if defined(__SSE4_2__)
+    return true;
+#elif defined(_MSC_VER) && !defined(__clang__)
+    int cpu_info[4];
+    __cpuid(cpu_info, 1);
+    return (cpu_info[2] & (1 << 20)) != 0;
+#else
+    return __builtin_cpu_supports("sse4.2") != 0;
+#endif
+}
+#endif
+
+// Hash bytes with no special meaning. Operate on non-inverted crc.
+static ImU32 ImHashDecoratedPathCrc32(ImU32 crc, const unsigned char* data, size_t data_size)
+{
+#if defined(IMGUI_TEST_ENGINE_HASH_CRC32C_ARM)
+    for (; data_size >= 8; data += 8, data_size -= 8)
+    {
+        ImU64 v;
+        memcpy(&v, data, 8);
+        crc = __crc32cd(crc, v);
+    }
+    for (; data_size > 0; data++, data_size--)
+        crc = __crc32cb(crc, *data);
+    return crc;
+#else
+#if defined(IMGUI_TEST_ENGINE_HASH_CRC32C_SSE42)
+    static const bool has_sse42 = ImHashDecoratedPathHasSSE42();
+    if (has_sse42)
+        return ImHashDecoratedPathCrc32_SSE42(crc, data, data_size);
+#endif
+    const ImU32* crc32_lut = GImGuiTestEngineCrc32LookupTable;
+    for (; data_size > 0; data++, data_size--)
+        crc = (crc >> 8) ^ crc32_lut[(crc & 0xFF) ^ *data];
+    return crc;
+#endif
+}
+
+static inline bool ImHashDecoratedPathIsSpecialChar(unsigned char c)
+{
+    return c == '\\' || c == '/' || c == '$' || c == '#';
+}
+
+// Return pointer to first character which may need special handling in ImHashDecoratedPath(), or str_end.
+static const unsigned char* ImHashDecoratedPathFindSpecialChar(const unsigned char* str, const unsigned char* str_end)
+{
+#if defined(IMGUI_TEST_ENGINE_HASH_SCAN_SSE2)
+    const __m128i v_backslash = _mm_set1_epi8('\\');
+    const __m128i v_slash = _mm_set1_epi8('/');
+    const __m128i v_dollar = _mm_set1_epi8('$');
+    const __m128i v_hash = _mm_set1_epi8('#');
+    for (; str_end - str >= 16; str += 16)
+    {
+        const __m128i v = _mm_loadu_si128((const __m128i*)(const void*)str);
+        const __m128i v_eq = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, v_backslash), _mm_cmpeq_epi8(v, v_slash)), _mm_or_si128(_mm_cmpeq_epi8(v, v_dollar), _mm_cmpeq_epi8(v, v_hash)));
+        const unsigned int mask = (unsigned int)_mm_movemask_epi8(v_eq);
+        if (mask != 0)
+        {
+#if defined(_MSC_VER) && !defined(__clang__)
+            unsigned long index;
+            _BitScanForward(&index, mask);
+            return str + index;
+#else
+            return str + __builtin_ctz(mask);
+#endif
+        }
+    }
+#elif defined(IMGUI_TEST_ENGINE_HASH_SCAN_NEON)
+    const uint8x16_t v_backslash = vdupq_n_u8('\\');
+    const uint8x16_t v_slash = vdupq_n_u8('/');
+    const uint8x16_t v_dollar = vdupq_n_u8('$');
+    const uint8x16_t v_hash = vdupq_n_u8('#');
+    for (; str_end - str >= 16; str += 16)
+    {
+        const uint8x16_t v = vld1q_u8(str);
+        const uint8x16_t v_eq = vorrq_u8(vorrq_u8(vceqq_u8(v, v_backslash), vceqq_u8(v, v_slash)), vorrq_u8(vceqq_u8(v, v_dollar), vceqq_u8(v, v_hash)));
+        if (vmaxvq_u8(v_eq) != 0)
+            break; // Locate in scalar loop below
+    }
+#endif
+    while (str < str_end && !ImHashDecoratedPathIsSpecialChar(*str))
+        str++;
+    return str;
+}
+
+// Hash "hello/world" as if it was "helloworld"
+// To hash a forward slash we need to use "hello\\/world"
+//   IM_ASSERT(ImHashDecoratedPath("Hello/world")   == ImHashStr("Helloworld", 0));
+//   IM_ASSERT(ImHashDecoratedPath("Hello\\/world") == ImHashStr("Hello/world", 0));
+//   IM_ASSERT(ImHashDecoratedPath("$$1")           == (n = 1, ImHashData(&n, sizeof(int))));
+// Adapted from ImHash(). Runs without special characters are located with SIMD and hashed in bulk.
 ImGuiID ImHashDecoratedPath(const char* str, const char* str_end, ImGuiID seed)
 {
     const ImU32* crc32_lut = GImGuiTestEngineCrc32LookupTable;
@@ -193,6 +336,16 @@ ImGuiID ImHashDecoratedPath(const char* str, const char* str_end, ImGuiID seed)
     const unsigned char* current = (const unsigned char*)str;
     while (current < (const unsigned char*)str_end)
     {
+        // Hash run of regular characters in bulk (this also covers a regular character following a backslash)
+        const unsigned char* run_end = ImHashDecoratedPathFindSpecialChar(current, (const unsigned char*)str_end);
+        if (run_end != current)
+        {
+            crc = ImHashDecoratedPathCrc32(crc, current, (size_t)(run_end - current));
+            current = run_end;
+            inhibit_one = new_section = false;
+            continue;
+        }
+
         const unsigned char c = *current++;
 
         // Backslash to inhibit special behavior of following character
@@ -239,6 +392,13 @@ ImGuiID ImHashDecoratedPath(const char* str, const char* str_end, ImGuiID seed)
     return ~crc;
 }
 
+// Only reached when ImHashDecoratedPathConstexpr() is evaluated at runtime with a "$$" literal: use ImHashDecoratedPath() instead.
+ImU32 ImHashDecoratedPathConstexprUnsupported()
+{
+    IM_ASSERT(0 && "ImHashDecoratedPathConstexpr() doesn't support \"$$\" literals.");
+    return 0;
+}
+
 // Returns a next element of decorated hash path.
 //    "//hello/world/child" --> "world/child"
 //    "world/child"         --> "child"
@@ -716,6 +876,7 @@ bool    ImParseFindIniSection(const char* ini_config, const char* header, ImVect
 // Time Helpers
 //-----------------------------------------------------------------------------
 // - ImTimeGetInMicroseconds()
+// - ImTimeGetThreadCpuTimeInMicroseconds()
 // - ImTimestampToISO8601()
 //-----------------------------------------------------------------------------
 
@@ -727,6 +888,30 @@ uint64_t ImTimeGetInMicroseconds()
     return (uint64_t)ms.count();
 }
 
+// CPU time consumed by the calling thread (user + kernel), excluding time spent blocked or preempted.
+// Windows' GetThreadTimes() is only updated on scheduler ticks (~15.6 ms): only meaningful when averaged over many frames.
+bool ImTimeGetThreadCpuTimeInMicroseconds(uint64_t* out_time_us)
+{
+#if defined(_WIN32)
+    FILETIME creation_time, exit_time, kernel_time, user_time;
+    if (!GetThreadTimes(GetCurrentThread(), &creation_time, &exit_time, &kernel_time, &user_time))
+        return false;
+    const uint64_t kernel_100ns = ((uint64_t)kernel_time.dwHighDateTime << 32) | kernel_time.dwLowDateTime;
+    const uint64_t user_100ns = ((uint64_t)user_time.dwHighDateTime << 32) | user_time.dwLowDateTime;
+    *out_time_us = (kernel_100ns + user_100ns) / 10;
+    return true;
+#elif defined(CLOCK_THREAD_CPUTIME_ID)
+    timespec ts;
+    if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) != 0)
+        return false;
+    *out_time_us = (uint64_t)ts.tv_sec * 1000000 + (uint64_t)ts.tv_nsec / 1000;
+    return true;
+#else
+    IM_UNUSED(out_time_us);
+    return false;
+#endif
+}
+
 void ImTimestampToISO8601(uint64_t timestamp_us, Str* out_date)
 {
     time_t unix_time = (time_t)(timestamp_us / 1000000); // Convert to seconds.
@@ -822,6 +1007,84 @@ void ImThreadSetCurrentThreadDescription(const char* description)
 #endif
 }
 
+//-----------------------------------------------------------------------------
+// Performance Counters Helpers
+//-----------------------------------------------------------------------------
+// - ImPerfCounters::Open()
+// - ImPerfCounters::Close()
+// - ImPerfCounters::Read()
+// - ImPerfCounterGetName()
+//-----------------------------------------------------------------------------
+
+#if defined(__linux) || defined(__linux__)
+static int ImPerfCounterOpenLinux(ImU64 config)
+{
+    perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = config;
+    attr.exclude_kernel = 1;    // Kernel and hypervisor counting usually requires elevated privileges
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    return (int)syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0); // pid = 0, cpu = -1: calling thread on any CPU.
+}
+#endif
+
+bool ImPerfCounters::Open()
+{
+    Close();
+    Opened = true;
+#if defined(__linux) || defined(__linux__)
+    static const ImU64 configs[] = { PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES };
+    IM_STATIC_ASSERT(IM_COUNTOF(configs) == ImPerfCounter_COUNT);
+    for (int n = 0; n < ImPerfCounter_COUNT; n++)
+        Fds[n] = ImPerfCounterOpenLinux(configs[n]);
+#endif
+    return IsAnyAvailable();
+}
+
+void ImPerfCounters::Close()
+{
+#if defined(__linux) || defined(__linux__)
+    for (int n = 0; n < ImPerfCounter_COUNT; n++)
+        if (Fds[n] != -1)
+            close(Fds[n]);
+#endif
+    for (int n = 0; n < ImPerfCounter_COUNT; n++)
+        Fds[n] = -1;
+    Opened = false;
+}
+
+void ImPerfCounters::Read(ImU64 out_values[ImPerfCounter_COUNT])
+{
+    for (int n = 0; n < ImPerfCounter_COUNT; n++)
+    {
+        out_values[n] = 0;
+#if defined(__linux) || defined(__linux__)
+        if (Fds[n] == -1)
+            continue;
+
+        // When more counters are requested than the PMU can hold, the kernel multiplexes them: scale value accordingly.
+        ImU64 data[3]; // value, time_enabled, time_running
+        if (read(Fds[n], data, sizeof(data)) != (ssize_t)sizeof(data))
+            continue;
+        if (data[2] != 0 && data[2] < data[1])
+            out_values[n] = (ImU64)((double)data[0] * ((double)data[1] / (double)data[2]));
+        else
+            out_values[n] = data[0];
+#endif
+    }
+}
+
+const char* ImPerfCounterGetName(ImPerfCounter counter)
+{
+    static const char* names[] = { "Instructions", "Cycles", "CacheMisses", "BranchMisses" };
+    IM_STATIC_ASSERT(IM_COUNTOF(names) == ImPerfCounter_COUNT);
+    IM_ASSERT(counter >= 0 && counter < ImPerfCounter_COUNT);
+    return names[counter];
+}
+
 //-----------------------------------------------------------------------------
 // Build info helpers
 //-----------------------------------------------------------------------------
@@ -1382,13 +1645,117 @@ void DrawDataVerifyMatchingBufferCount(ImDrawData* draw_data)
 #endif
 }
 
+//-----------------------------------------------------------------------------
+// Source files cache
+//-----------------------------------------------------------------------------
+
+// Contents are copied in memory: file may be edited, truncated or replaced while it is cached.
+bool ImSourceFile::Load(const char* filename)
+{
+    Unload();
+    FileNameHash = ImHashStr(filename);
+    if (FileName == nullptr || strcmp(FileName, filename) != 0)
+    {
+        IM_FREE(FileName);
+        FileName = ImStrdup(filename);
+    }
+    struct stat file_stat;
+    if (stat(filename, &file_stat) != 0)
+        return false;
+    FileModTime = (ImU64)file_stat.st_mtime;
+    FileSize = (ImU64)file_stat.st_size;
+    Data = (char*)ImFileLoadToMemory(filename, "rb", &DataSize, 0);
+    return Data != nullptr;
+}
+
+void ImSourceFile::Unload()
+{
+    if (Data != nullptr)
+        IM_FREE(Data);
+    Data = nullptr;
+    DataSize = 0;
+    FileModTime = FileSize = 0;
+    LineOffsets.clear();
+}
+
+// Return true if file on disk was modified, deleted or replaced since it was loaded
+bool ImSourceFile::IsOutdated(const char* filename)
+{
+    struct stat file_stat;
+    if (stat(filename, &file_stat) != 0)
+        return true;
+    return (ImU64)file_stat.st_mtime != FileModTime || (ImU64)file_stat.st_size != FileSize;
+}
+
+int ImSourceFile::GetLineCount()
+{
+    if (LineOffsets.Size == 0 && Data != nullptr)
+    {
+        const char* data_end = Data + DataSize;
+        for (const char* p = Data; p < data_end; )
+        {
+            LineOffsets.push_back((int)(p - Data));
+            const char* line_end = (const char*)memchr(p, '\n', (size_t)(data_end - p));
+            p = line_end ? line_end + 1 : data_end;
+        }
+        LineOffsets.push_back((int)DataSize);
+    }
+    return LineOffsets.Size > 0 ? LineOffsets.Size - 1 : 0;
+}
+
+bool ImSourceFile::GetLines(int line_no_start, int line_no_end, const char** out_begin, const char** out_end)
+{
+    const int line_count = GetLineCount();
+    line_no_start = ImMax(line_no_start, 1);
+    line_no_end = ImMin(line_no_end, line_count);
+    if (line_no_start > line_no_end)
+        return false;
+    *out_begin = Data + LineOffsets[line_no_start - 1];
+    *out_end = Data + LineOffsets[line_no_end];
+    if (*out_end > *out_begin && (*out_end)[-1] == '\n')
+        (*out_end)--;
+    return true;
+}
+
+// Cached files are reloaded in place when outdated, so returned pointers stay valid until Clear().
+ImSourceFile* ImSourceFileCache::GetOrLoad(const char* filename)
+{
+    const ImGuiID filename_hash = ImHashStr(filename);
+    for (ImSourceFile* file : Files)
+        if (file->FileNameHash == filename_hash && strcmp(file->FileName, filename) == 0)
+        {
+            if (file->IsOutdated(filename) && !file->Load(filename))
+            {
+                Files.find_erase(file);
+                IM_DELETE(file);
+                return nullptr;
+            }
+            return file;
+        }
+    ImSourceFile* file = IM_NEW(ImSourceFile)();
+    if (!file->Load(filename))
+    {
+        IM_DELETE(file);
+        return nullptr;
+    }
+    Files.push_back(file);
+    return file;
+}
+
+void ImSourceFileCache::Clear()
+{
+    for (ImSourceFile* file : Files)
+        IM_DELETE(file);
+    Files.clear();
+}
+
 //-----------------------------------------------------------------------------
 // Simple CSV parser
 //-----------------------------------------------------------------------------
 
 void ImGuiCsvParser::Clear()
 {
-    Rows = Columns = 0;
+    Rows = Columns = ColumnsMin = 0;
     if (_Data != nullptr)
         IM_FREE(_Data);
     _Data = nullptr;
@@ -1435,7 +1802,8 @@ bool ImGuiCsvParser::Load(const char* filename)
         const bool is_eof = (*c == '\0');
         if (is_comma || is_eol || is_eof)
         {
-            _Index[Rows * columns + col] = col_data;
+            if (col < columns)
+                _Index[Rows * columns + col] = col_data;
             col_data = c + 1;
             if (is_comma)
             {
@@ -1444,9 +1812,20 @@ bool ImGuiCsvParser::Load(const char* filename)
             else
             {
                 if (col + 1 == columns)
+                {
+                    Rows++;
+                }
+                else if (col + 1 < columns && ColumnsMin > 0 && col + 1 >= ColumnsMin)
+                {
+                    static char empty_cell[1] = "";
+                    for (int missing_col = col + 1; missing_col < columns; missing_col++)
+                        _Index[Rows * columns + missing_col] = empty_cell;
                     Rows++;
+                }
                 else
+                {
                     fprintf(stderr, "%s: Unexpected number of columns on line %d, ignoring.\n", filename, Rows + 1); // FIXME
+                }
                 col = 0;
             }
             *c = 0;
@@ -23,6 +23,38 @@ class Str;          // Str<> from thirdparty/Str/Str.h
 ImGuiID     ImHashDecoratedPath(const char* str, const char* str_end = nullptr, ImGuiID seed = 0);
 const char* ImFindNextDecoratedPartInPath(const char* str, const char* str_end = nullptr);
 
+// Compile-time version of ImHashDecoratedPath(), e.g.
+//   static constexpr ImGuiID button_id = ImHashDecoratedPathConstexpr("Window/Button");
+//   ctx->ItemClick(button_id);
+// - Only evaluated at compile-time when required by the expression (e.g. assigning to a constexpr variable). Otherwise it runs at runtime.
+// - Supports "/" separators, "\\" escapes and "###". Does NOT support "$$" literals: compile error when evaluated at compile-time, assert when evaluated at runtime.
+// - Written as C++11 single-expression recursion: paths are limited by compiler constexpr depth (default ~512 characters).
+#if (IMGUI_VERSION_NUM < 19152) || defined(IMGUI_USE_LEGACY_CRC32_ADLER)
+#define IM_HASH_DECORATED_PATH_CRC32_POLY   0xEDB88320u     // Must match lookup table used by ImHashStr()
+#else
+#define IM_HASH_DECORATED_PATH_CRC32_POLY   0x82F63B78u     // CRC32C
+#endif
+ImU32               ImHashDecoratedPathConstexprUnsupported();  // Not constexpr on purpose: triggers a compile error with "$$" in compile-time evaluation.
+constexpr ImU32     ImHashDecoratedPathConstexprBits(ImU32 crc, int bits) { return bits == 0 ? crc : ImHashDecoratedPathConstexprBits((crc >> 1) ^ (IM_HASH_DECORATED_PATH_CRC32_POLY & (0u - (crc & 1u))), bits - 1); }
+constexpr ImU32     ImHashDecoratedPathConstexprByte(ImU32 crc, char c) { return ImHashDecoratedPathConstexprBits(crc ^ (unsigned char)c, 8); }
+constexpr ImU32     ImHashDecoratedPathConstexprStep(const char* s, ImU32 crc, ImU32 seed, bool inhibit_one, bool new_section)
+{
+    return (s[0] == 0) ? crc
+        : (s[0] == '\\' && !inhibit_one) ? ImHashDecoratedPathConstexprStep(s + 1, crc, seed, true, new_section)
+        : (s[0] == '/' && !inhibit_one) ? ImHashDecoratedPathConstexprStep(s + 1, crc, crc, false, true)
+        : (s[0] == '$' && s[1] == '$' && !inhibit_one && new_section) ? ImHashDecoratedPathConstexprUnsupported()
+#if IMGUI_VERSION_NUM >= 19255
+        : (s[0] == '#' && s[1] == '#' && s[2] == '#') ? ImHashDecoratedPathConstexprStep(s + 3, seed, seed, false, false)
+#else
+        : (s[0] == '#' && s[1] == '#' && s[2] == '#') ? ImHashDecoratedPathConstexprStep(s + 1, ImHashDecoratedPathConstexprByte(seed, '#'), seed, false, false)
+#endif
+        : ImHashDecoratedPathConstexprStep(s + 1, ImHashDecoratedPathConstexprByte(crc, s[0]), seed, false, false);
+}
+constexpr ImGuiID   ImHashDecoratedPathConstexpr(const char* str, ImGuiID seed = 0)
+{
+    return ~ImHashDecoratedPathConstexprStep(str, ~(str[0] == '/' ? 0u : seed), ~(str[0] == '/' ? 0u : seed), false, true);
+}
+
 //-----------------------------------------------------------------------------
 // File/Directory Helpers
 //-----------------------------------------------------------------------------
@@ -64,6 +96,7 @@ bool        ImParseFindIniSection(const char* ini_config, const char* header, Im
 //-----------------------------------------------------------------------------
 
 uint64_t    ImTimeGetInMicroseconds();
+bool        ImTimeGetThreadCpuTimeInMicroseconds(uint64_t* out_time_us);   // Return false when unsupported
 void        ImTimestampToISO8601(uint64_t timestamp_us, Str* out_date);
 
 //-----------------------------------------------------------------------------
@@ -73,6 +106,38 @@ void        ImTimestampToISO8601(uint64_t timestamp_us, Str* out_date);
 void        ImThreadSleepInMilliseconds(int ms);
 void        ImThreadSetCurrentThreadDescription(const char* description);
 
+//-----------------------------------------------------------------------------
+// Performance Counters Helpers
+//-----------------------------------------------------------------------------
+
+enum ImPerfCounter
+{
+    ImPerfCounter_Instructions,
+    ImPerfCounter_Cycles,
+    ImPerfCounter_CacheMisses,
+    ImPerfCounter_BranchMisses,
+    ImPerfCounter_COUNT
+};
+
+// Hardware performance counters for the calling thread (user-space only).
+// Only implemented on Linux using perf_event_open(). Counters may be unavailable on other platforms, in virtual
+// machines, in containers or when restricted by /proc/sys/kernel/perf_event_paranoid: IsAvailable() will return false.
+struct ImPerfCounters
+{
+    int         Fds[ImPerfCounter_COUNT];
+    bool        Opened = false;                 // Open() was called (successfully or not).
+
+    ImPerfCounters()                            { for (int n = 0; n < ImPerfCounter_COUNT; n++) Fds[n] = -1; }
+    ~ImPerfCounters()                           { Close(); }
+    bool        Open();                         // Start counting for calling thread. Return false if no counter is available.
+    void        Close();
+    void        Read(ImU64 out_values[ImPerfCounter_COUNT]); // Unavailable counters output 0.
+    bool        IsAvailable(ImPerfCounter counter) const { return Fds[counter] != -1; }
+    bool        IsAnyAvailable() const          { for (int n = 0; n < ImPerfCounter_COUNT; n++) if (Fds[n] != -1) return true; return false; }
+};
+
+const char* ImPerfCounterGetName(ImPerfCounter counter);
+
 //-----------------------------------------------------------------------------
 // Build Info helpers
 //-----------------------------------------------------------------------------
@@ -168,6 +233,7 @@ struct ImGuiCsvParser
 {
     // Public fields
     int             Columns = 0;                    // Number of columns in CSV file.
+    int             ColumnsMin = 0;                 // Minimum number of columns for a row to be accepted (when Columns is provided). Missing trailing cells are empty strings.
     int             Rows = 0;                       // Number of rows in CSV file.
 
     // Internal fields
@@ -182,6 +248,40 @@ struct ImGuiCsvParser
     const char*     GetCell(int row, int col)       { IM_ASSERT(0 <= row && row < Rows && 0 <= col && col < Columns); return _Index[row * Columns + col]; }
 };
 
+//-----------------------------------------------------------------------------
+// Helper: Source files cache
+//-----------------------------------------------------------------------------
+
+// Contents of a source file loaded in memory + index of line offsets built on first use.
+// Line numbers are 1-based. Lines exclude their trailing '\n'. Contents are not zero-terminated.
+struct ImSourceFile
+{
+    ImGuiID         FileNameHash = 0;
+    char*           FileName = nullptr;             // Owned copy, compared on hash match
+    char*           Data = nullptr;
+    size_t          DataSize = 0;
+    ImU64           FileModTime = 0;                // File modification time and size when loaded, to detect changes
+    ImU64           FileSize = 0;
+    ImVector<int>   LineOffsets;                    // Offset of each line start, +1 entry for end of data
+
+    ~ImSourceFile()                                 { Unload(); IM_FREE(FileName); }
+    bool            Load(const char* filename);
+    void            Unload();
+    bool            IsOutdated(const char* filename);
+    int             GetLineCount();
+    bool            GetLines(int line_no_start, int line_no_end, const char** out_begin, const char** out_end); // Clamped to available lines
+};
+
+// Cache of source files shared by all tests, so displaying N lines of a test source is O(N) after a file is loaded once.
+struct ImSourceFileCache
+{
+    ImVector<ImSourceFile*> Files;
+
+    ~ImSourceFileCache()                            { Clear(); }
+    ImSourceFile*   GetOrLoad(const char* filename);    // Return nullptr if file can't be loaded. Reload file if modified on disk.
+    void            Clear();
+};
+
 //-----------------------------------------------------------------------------
 // Misc Dear ImGui extensions
 //-----------------------------------------------------------------------------
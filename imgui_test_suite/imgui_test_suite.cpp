@@ -70,6 +70,19 @@
 #include "misc/freetype/imgui_freetype.cpp"
 #endif
 
+// Server mode (-server/-connect) uses Unix domain sockets
+#if defined(__linux) || defined(__linux__) || defined(__APPLE__)
+#define IMGUI_TEST_SUITE_ENABLE_SERVER 1
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <signal.h>
+#else
+#define IMGUI_TEST_SUITE_ENABLE_SERVER 0
+#endif
+
 //-------------------------------------------------------------------------
 // Forward Declarations
 //-------------------------------------------------------------------------
@@ -80,6 +93,12 @@ static void TestSuite_PrintCommandLineHelp();
 static bool TestSuite_ParseCommandLineOptions(TestSuiteApp* app, int argc, char** argv);
 static void TestSuite_QueueTests(TestSuiteApp* app, ImGuiTestRunFlags run_flags);
 static void TestSuite_LoadFonts();
+#if IMGUI_TEST_SUITE_ENABLE_SERVER
+static bool TestSuite_ServerStart(TestSuiteApp* app);
+static void TestSuite_ServerStop(TestSuiteApp* app);
+static void TestSuite_ServerUpdate(TestSuiteApp* app);
+static int  TestSuite_ClientRun(TestSuiteApp* app);
+#endif
 
 //-------------------------------------------------------------------------
 // Test Application
@@ -87,6 +106,23 @@ static void TestSuite_LoadFonts();
 
 struct ImGuiApp;
 
+// State for -server mode: one client connection and one request at a time
+struct TestSuiteServer
+{
+    int                         ListenFd = -1;
+    int                         ClientFd = -1;
+    ImGuiTextBuffer             RequestBuf;             // Incoming request text, until an empty line or end of stream
+    ImGuiTextBuffer             SendBuf;                // Output not sent yet (client socket is non-blocking)
+    int                         SendOffset = 0;         // Start of unsent data in SendBuf
+    ImU64                       SendStallTime = 0;      // Time when client stopped reading, 0 when not stalled
+    bool                        SendClosing = false;    // Close client once SendBuf is flushed
+    bool                        RequestRunning = false;
+    ImVector<ImGuiTest*>        RequestTests;           // Tests queued by current request, in execution order
+    int                         RequestReportedCount = 0;
+    Str128                      RequestExportFilename;
+    bool                        QuitRequested = false;
+};
+
 struct TestSuiteApp
 {
     // Main State
@@ -100,6 +136,7 @@ struct TestSuiteApp
     bool                        OptGuiFunc = false;
     bool                        OptListTests = false;
     ImGuiTestRunSpeed           OptRunSpeed = ImGuiTestRunSpeed_Fast;
+    bool                        OptVirtualTime = false;
     ImGuiTestVerboseLevel       OptVerboseLevelBasic = ImGuiTestVerboseLevel_COUNT; // Default is set in main.cpp depending on -gui/-nogui
     ImGuiTestVerboseLevel       OptVerboseLevelError = ImGuiTestVerboseLevel_COUNT; // "
     bool                        OptNoThrottle = false;
@@ -108,11 +145,24 @@ struct TestSuiteApp
     bool                        OptMockViewports = false;
     bool                        OptCaptureEnabled = true;
     int                         OptStressAmount = 5;
+    int                         OptStressSweepSteps = 0;
+    bool                        OptPerfCounters = false;
+    bool                        OptPerfCpuTime = false;
+    bool                        OptFastInputCoalescing = false;
+    int                         OptKeyCharsPerFrame = 0;
+    bool                        OptRestoreUiState = false;
+    bool                        OptItemGraph = false;
+    bool                        OptForkIsolation = false;
     float                       OptScale = 0.0f;
     Str128                      OptSourceFileOpener;
     Str128                      OptExportFilename;
     ImGuiTestEngineExportFormat OptExportFormat = ImGuiTestEngineExportFormat_JUnitXml;
+    Str128                      OptServerSocket;
+    Str128                      OptConnectSocket;
     ImVector<char*>             TestsToRun;
+
+    // Server mode
+    TestSuiteServer             Server;
 };
 
 static void TestSuite_ShowUI(TestSuiteApp* app)
@@ -171,14 +221,25 @@ static void TestSuite_PrintCommandLineHelp()
     printf("  -guifunc                 : run test GuiFunc only (no TestFunc).\n");
     printf("  -scale <float>/auto      : set content scale (default: auto = pulled from system on GUI mode, 1.0 in console mode)\n");
     printf("  -slow                    : run automation at feeble human speed.\n");
+    printf("  -fastinputs              : in fast mode, coalesce mouse/keyboard inputs to use fewer frames per action.\n");
+    printf("  -keycharsperframe <int>  : in fast mode, submit typed characters <int> per frame (default: 0 = all at once).\n");
+    printf("  -restoreuistate          : restore windows, settings, tables and docking state before each test.\n");
+    printf("  -itemgraph               : maintain a live item graph to answer GatherItems() queries without yielding.\n");
+    printf("  -fork                    : run each test in a fork() of the warmed-up process, isolating state and crashes (Linux only, requires -nogui).\n");
+    printf("  -virtualtime             : use simulated clock: run -slow automation and video captures as fast as possible.\n");
     printf("  -nothrottle              : run GUI app without throttling/vsync by default.\n");
     printf("  -nopause                 : don't pause application on exit.\n");
     printf("  -nocapture               : don't capture any images or video.\n");
     printf("  -stressamount <int>      : set performance test duration multiplier (default: 5)\n");
+    printf("  -stresssweep <int>       : run performance tests <int> times, doubling stress amount each time, and fit scaling.\n");
+    printf("  -perfcounters            : capture hardware performance counters in performance tests (Linux only).\n");
+    printf("  -perfcputime             : measure main thread CPU time of NewFrame->Render and Render->PreSwap in performance tests.\n");
     printf("  -fileopener <file>       : provide a bat/cmd/shell script to open source file (default to open with shell).\n");
     printf("  -export-file <file>      : save test run results in specified file.\n");
     printf("  -export-format <format>  : save test run results in specified format. (default: junit)\n");
     printf("  -list                    : list queued tests (one per line) and exit.\n");
+    printf("  -server <socket>         : stay resident and run tests requested on a Unix socket (Linux/macOS only).\n");
+    printf("  -connect <socket>        : send queued tests to a -server instance, print its results and exit.\n");
     printf("Tests:\n");
     printf("   all/tests/perf          : queue by groups: all, only tests, only performance benchmarks.\n");
     printf("   [pattern]               : queue all tests containing the word [pattern].\n");
@@ -220,9 +281,16 @@ static bool TestSuite_ParseCommandLineOptions(TestSuiteApp* app, int argc, char*
         else if (strcmp(argv[n], "-guifunc") == 0)      { app->OptGuiFunc = true; }
         else if (strcmp(argv[n], "-fast") == 0)         { app->OptRunSpeed = ImGuiTestRunSpeed_Fast; app->OptNoThrottle = true; }
         else if (strcmp(argv[n], "-slow") == 0)         { app->OptRunSpeed = ImGuiTestRunSpeed_Normal; app->OptNoThrottle = false; }
+        else if (strcmp(argv[n], "-virtualtime") == 0)  { app->OptVirtualTime = true; }
         else if (strcmp(argv[n], "-nothrottle") == 0)   { app->OptNoThrottle = true; }
+        else if (strcmp(argv[n], "-fastinputs") == 0)   { app->OptFastInputCoalescing = true; }
+        else if (strcmp(argv[n], "-restoreuistate") == 0) { app->OptRestoreUiState = true; }
+        else if (strcmp(argv[n], "-itemgraph") == 0) { app->OptItemGraph = true; }
+        else if (strcmp(argv[n], "-fork") == 0)         { app->OptForkIsolation = true; }
         else if (strcmp(argv[n], "-nopause") == 0)      { app->OptPauseOnExit = false; }
         else if (strcmp(argv[n], "-nocapture") == 0)    { app->OptCaptureEnabled = false; }
+        else if (strcmp(argv[n], "-perfcounters") == 0) { app->OptPerfCounters = true; }
+        else if (strcmp(argv[n], "-perfcputime") == 0)  { app->OptPerfCpuTime = true; }
         else if (strcmp(argv[n], "-viewport") == 0)     { app->OptViewports = true; }
         else if (strcmp(argv[n], "-viewport-mock") == 0){ app->OptViewports = app->OptMockViewports = true; }
         else if (strcmp(argv[n], "-scale") == 0 && n + 1 < argc)
@@ -247,6 +315,16 @@ static bool TestSuite_ParseCommandLineOptions(TestSuiteApp* app, int argc, char*
             app->OptStressAmount = atoi(argv[n + 1]);
             n++;
         }
+        else if (strcmp(argv[n], "-stresssweep") == 0 && n + 1 < argc)
+        {
+            app->OptStressSweepSteps = atoi(argv[n + 1]);
+            n++;
+        }
+        else if (strcmp(argv[n], "-keycharsperframe") == 0 && n + 1 < argc)
+        {
+            app->OptKeyCharsPerFrame = ImMax(atoi(argv[n + 1]), 0);
+            n++;
+        }
         else if (strcmp(argv[n], "-fileopener") == 0 && n + 1 < argc)
         {
             app->OptSourceFileOpener = argv[n + 1];
@@ -276,6 +354,19 @@ static bool TestSuite_ParseCommandLineOptions(TestSuiteApp* app, int argc, char*
             app->OptListTests = true;
             app->OptGui = false;
         }
+        else if ((strcmp(argv[n], "-server") == 0 || strcmp(argv[n], "-connect") == 0) && n + 1 < argc)
+        {
+#if IMGUI_TEST_SUITE_ENABLE_SERVER
+            if (strcmp(argv[n], "-server") == 0)
+                app->OptServerSocket = argv[n + 1];
+            else
+                app->OptConnectSocket = argv[n + 1];
+            n++;
+#else
+            fprintf(stderr, "'%s' is not supported on this platform.\n", argv[n]);
+            return false;
+#endif
+        }
         else
         {
             printf("Syntax: %s <options> [tests...]\n", argv[0]);
@@ -347,8 +438,8 @@ static void TestSuite_LoadFonts()
 
 static void TestSuite_QueueTests(TestSuiteApp* app, ImGuiTestRunFlags run_flags)
 {
-    // Non-interactive mode queue all tests by default
-    if (!app->OptGui && app->TestsToRun.empty())
+    // Non-interactive mode queue all tests by default (unless waiting for requests in server mode)
+    if (!app->OptGui && app->TestsToRun.empty() && app->OptServerSocket.empty())
         app->TestsToRun.push_back(strdup("tests"));
 
     // Special groups are supported by ImGuiTestEngine_QueueTests(): "all", "tests", "perfs"
@@ -389,6 +480,355 @@ static void FindVideoEncoder(char* out, int out_len)
         *out = 0;
 }
 
+//-------------------------------------------------------------------------
+// Server Mode
+//-------------------------------------------------------------------------
+// Keep the test suite resident so repeated targeted runs don't pay for context creation, font atlas build and test registration.
+//   ./imgui_test_suite -nogui -server /tmp/imgui_test_suite.sock           // Start server
+//   ./imgui_test_suite -connect /tmp/imgui_test_suite.sock widgets_input   // Queue tests, stream results, exit with same code as a local run
+// A request is made of text lines, terminated by an empty line or end of stream (empty requests are ignored):
+//   filter <spec,...>        : tests to queue, same syntax as command-line (default: "tests")
+//   guifunc                  : run GuiFunc only (no TestFunc)
+//   export <file>            : save results of this request in JUnit format
+//   quit                     : stop the server (e.g. 'echo quit | nc -U /tmp/imgui_test_suite.sock')
+// Response is streamed as tests complete: one "test <ok|error|aborted> <name>" line per test (error logs follow, indented),
+// then a final "result <ok|errors> <passed>/<tested>" line, after which the connection is closed.
+// Output is buffered while client doesn't read it, and a client which stops reading for 10 seconds is disconnected.
+// Test results are reset and UI state is restored around each request, so requests are independent of each other.
+//-------------------------------------------------------------------------
+
+#if IMGUI_TEST_SUITE_ENABLE_SERVER
+
+static const float TestSuite_ServerSendTimeout = 10.0f;  // Drop a client which doesn't read its output for this many seconds
+
+static void TestSuite_ServerCloseClient(TestSuiteServer* server)
+{
+    if (server->ClientFd != -1)
+        close(server->ClientFd);
+    server->ClientFd = -1;
+    server->SendBuf.clear();
+    server->SendOffset = 0;
+    server->SendStallTime = 0;
+    server->SendClosing = false;
+}
+
+// Send as much buffered output as client socket accepts without blocking
+static void TestSuite_ServerFlush(TestSuiteServer* server)
+{
+    while (server->ClientFd != -1 && server->SendOffset < server->SendBuf.size())
+    {
+        ssize_t sent = send(server->ClientFd, server->SendBuf.begin() + server->SendOffset, (size_t)(server->SendBuf.size() - server->SendOffset), 0);
+        if (sent < 0 && errno == EINTR)
+            continue;
+        if (sent < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+        {
+            // Client is not reading: retry on next frames, drop it if it stays stalled (request keeps running)
+            const ImU64 time = ImTimeGetInMicroseconds();
+            if (server->SendStallTime == 0)
+                server->SendStallTime = time;
+            else if ((double)(time - server->SendStallTime) / 1000000.0 > TestSuite_ServerSendTimeout)
+            {
+                fprintf(stderr, "Server: client stopped reading for %.f seconds, closing connection.\n", TestSuite_ServerSendTimeout);
+                TestSuite_ServerCloseClient(server);
+            }
+            return;
+        }
+        if (sent <= 0)
+        {
+            TestSuite_ServerCloseClient(server); // Client went away: keep running the request but stop streaming.
+            return;
+        }
+        server->SendOffset += (int)sent;
+        server->SendStallTime = 0;
+    }
+    server->SendBuf.clear();
+    server->SendOffset = 0;
+}
+
+static void TestSuite_ServerSend(TestSuiteServer* server, const char* data, int data_len)
+{
+    if (server->ClientFd == -1)
+        return;
+    server->SendBuf.append(data, data + data_len);
+    TestSuite_ServerFlush(server);
+}
+
+static bool TestSuite_ServerStart(TestSuiteApp* app)
+{
+    TestSuiteServer* server = &app->Server;
+    const char* path = app->OptServerSocket.c_str();
+
+    struct sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if (strlen(path) >= sizeof(addr.sun_path))
+    {
+        fprintf(stderr, "Server socket path '%s' is too long.\n", path);
+        return false;
+    }
+    strcpy(addr.sun_path, path);
+
+    signal(SIGPIPE, SIG_IGN); // Report disconnected clients through send() errors
+    server->ListenFd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (server->ListenFd == -1)
+        return false;
+    unlink(path); // Remove stale socket left by a previous instance
+    if (bind(server->ListenFd, (struct sockaddr*)&addr, sizeof(addr)) != 0 || listen(server->ListenFd, 4) != 0)
+    {
+        fprintf(stderr, "Failed to listen on '%s': %s\n", path, strerror(errno));
+        close(server->ListenFd);
+        server->ListenFd = -1;
+        return false;
+    }
+    fcntl(server->ListenFd, F_SETFL, fcntl(server->ListenFd, F_GETFL, 0) | O_NONBLOCK);
+    printf("Server listening on '%s'\n", path);
+    return true;
+}
+
+static void TestSuite_ServerStop(TestSuiteApp* app)
+{
+    TestSuiteServer* server = &app->Server;
+    TestSuite_ServerCloseClient(server);
+    if (server->ListenFd != -1)
+    {
+        close(server->ListenFd);
+        unlink(app->OptServerSocket.c_str());
+    }
+    server->ListenFd = -1;
+}
+
+static void TestSuite_ServerBeginRequest(TestSuiteApp* app)
+{
+    TestSuiteServer* server = &app->Server;
+    ImGuiTestEngine* engine = app->TestEngine;
+
+    // Parse request
+    Str256 filter;
+    ImGuiTestRunFlags run_flags = ImGuiTestRunFlags_RunFromCommandLine;
+    server->RequestExportFilename.clear();
+    const char* line_end = nullptr;
+    for (const char* line = server->RequestBuf.begin(); line < server->RequestBuf.end(); line = line_end + 1)
+    {
+        line_end = strchr(line, '\n');
+        if (line_end == nullptr)
+            line_end = server->RequestBuf.end();
+        Str256 cmd;
+        cmd.set(line, line_end);
+        if (cmd.length() > 0 && cmd.c_str()[cmd.length() - 1] == '\r')
+            cmd.c_str()[cmd.length() - 1] = 0;
+        if (strncmp(cmd.c_str(), "filter ", 7) == 0)
+            filter.set(cmd.c_str() + 7);
+        else if (strcmp(cmd.c_str(), "guifunc") == 0)
+            run_flags |= ImGuiTestRunFlags_GuiFuncOnly;
+        else if (strncmp(cmd.c_str(), "export ", 7) == 0)
+            server->RequestExportFilename.set(cmd.c_str() + 7);
+        else if (strcmp(cmd.c_str(), "quit") == 0)
+            server->QuitRequested = true;
+    }
+    server->RequestBuf.clear();
+    if (server->QuitRequested)
+        return;
+    if (filter.empty())
+        filter.set("tests");
+
+    // Clear results of previous requests so summary and export only cover this request
+    ImVector<ImGuiTest*> all_tests;
+    ImGuiTestEngine_GetTestList(engine, &all_tests);
+    for (ImGuiTest* test : all_tests)
+        test->Output.Status = ImGuiTestStatus_Unknown;
+
+    ImGuiTestEngine_QueueTests(engine, ImGuiTestGroup_Unknown, filter.c_str(), run_flags);
+    ImVector<ImGuiTestRunTask> queue;
+    ImGuiTestEngine_GetTestQueue(engine, &queue);
+    server->RequestTests.resize(0);
+    for (ImGuiTestRunTask& run_task : queue)
+        server->RequestTests.push_back(run_task.Test);
+    server->RequestReportedCount = 0;
+    server->RequestRunning = true;
+    printf("Server: running '%s' (%d tests)\n", filter.c_str(), server->RequestTests.Size);
+}
+
+static void TestSuite_ServerEndRequest(TestSuiteApp* app)
+{
+    TestSuiteServer* server = &app->Server;
+    ImGuiTestEngine* engine = app->TestEngine;
+
+    if (!server->RequestExportFilename.empty())
+        ImGuiTestEngine_ExportEx(engine, ImGuiTestEngineExportFormat_JUnitXml, server->RequestExportFilename.c_str());
+
+    ImGuiTestEngineResultSummary summary;
+    ImGuiTestEngine_GetResultSummary(engine, &summary);
+    Str64f result("result %s %d/%d\n", (summary.CountSuccess == summary.CountTested) ? "ok" : "errors", summary.CountSuccess, summary.CountTested);
+    TestSuite_ServerSend(server, result.c_str(), result.length());
+
+    // Connection is closed once remaining output is flushed
+    server->SendClosing = true;
+    server->RequestRunning = false;
+}
+
+// Called once per frame, outside of NewFrame()/Render()
+static void TestSuite_ServerUpdate(TestSuiteApp* app)
+{
+    TestSuiteServer* server = &app->Server;
+    ImGuiTestEngine* engine = app->TestEngine;
+
+    // Flush output of previous request before accepting next client
+    if (server->SendClosing)
+    {
+        TestSuite_ServerFlush(server);
+        if (server->ClientFd != -1 && server->SendBuf.size() > 0)
+            return;
+        TestSuite_ServerCloseClient(server);
+    }
+
+    // Accept one client at a time
+    if (server->ClientFd == -1 && !server->RequestRunning)
+    {
+        server->ClientFd = accept(server->ListenFd, nullptr, nullptr);
+        if (server->ClientFd == -1)
+            return;
+        fcntl(server->ClientFd, F_SETFL, fcntl(server->ClientFd, F_GETFL, 0) | O_NONBLOCK);
+        server->RequestBuf.clear();
+    }
+
+    // Read request
+    if (!server->RequestRunning)
+    {
+        bool request_complete = false;
+        char buf[1024];
+        while (!request_complete)
+        {
+            ssize_t len = recv(server->ClientFd, buf, sizeof(buf), 0);
+            if (len < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR))
+                return;
+            if (len <= 0)
+                request_complete = true; // End of stream
+            else
+                server->RequestBuf.append(buf, buf + len);
+            if (strstr(server->RequestBuf.c_str(), "\n\n") != nullptr || strstr(server->RequestBuf.c_str(), "\r\n\r\n") != nullptr)
+                request_complete = true;
+        }
+
+        // Ignore empty requests (e.g. a client connecting then closing without sending anything)
+        bool request_empty = true;
+        for (const char* p = server->RequestBuf.begin(); p < server->RequestBuf.end() && request_empty; p++)
+            request_empty = (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n');
+        if (request_empty)
+        {
+            server->RequestBuf.clear();
+            TestSuite_ServerCloseClient(server);
+            return;
+        }
+        TestSuite_ServerBeginRequest(app);
+        return;
+    }
+
+    TestSuite_ServerFlush(server);
+
+    // Stream results of completed tests (queue runs in order)
+    for (; server->RequestReportedCount < server->RequestTests.Size; server->RequestReportedCount++)
+    {
+        ImGuiTest* test = server->RequestTests[server->RequestReportedCount];
+        const ImGuiTestStatus status = test->Output.Status;
+        if (status != ImGuiTestStatus_Success && status != ImGuiTestStatus_Error && status != ImGuiTestStatus_Unknown)
+            break;
+        Str256f line("test %s %s\n", (status == ImGuiTestStatus_Success) ? "ok" : (status == ImGuiTestStatus_Error) ? "error" : "aborted", test->Name);
+        TestSuite_ServerSend(server, line.c_str(), line.length());
+        if (status == ImGuiTestStatus_Error)
+        {
+            ImGuiTextBuffer log;
+            test->Output.Log.ExtractLinesForVerboseLevels(ImGuiTestVerboseLevel_Error, ImGuiTestVerboseLevel_Warning, &log);
+            for (const char* p = log.begin(); p < log.end(); )
+            {
+                const char* p_eol = strchr(p, '\n');
+                p_eol = p_eol ? p_eol + 1 : log.end();
+                TestSuite_ServerSend(server, "  ", 2);
+                TestSuite_ServerSend(server, p, (int)(p_eol - p));
+                p = p_eol;
+            }
+        }
+    }
+
+    if (ImGuiTestEngine_IsTestQueueEmpty(engine) && !ImGuiTestEngine_GetIO(engine).IsRunningTests && server->RequestReportedCount == server->RequestTests.Size)
+        TestSuite_ServerEndRequest(app);
+}
+
+// -connect: send request to a running server and relay its output. Return value for main().
+static int TestSuite_ClientRun(TestSuiteApp* app)
+{
+    const char* path = app->OptConnectSocket.c_str();
+    struct sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    ImStrncpy(addr.sun_path, path, IM_COUNTOF(addr.sun_path));
+
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd == -1 || connect(fd, (struct sockaddr*)&addr, sizeof(addr)) != 0)
+    {
+        fprintf(stderr, "Failed to connect to '%s': %s\n", path, strerror(errno));
+        if (fd != -1)
+            close(fd);
+        return ImGuiTestAppErrorCode_CommandLineError;
+    }
+
+    Str256 request;
+    if (app->TestsToRun.empty())
+    {
+        request.append("filter tests\n"); // Same default as a local run
+    }
+    else
+    {
+        request.append("filter ");
+        for (int n = 0; n < app->TestsToRun.Size; n++)
+        {
+            if (n > 0)
+                request.append(",");
+            request.append(app->TestsToRun[n]);
+            IM_FREE(app->TestsToRun[n]);
+        }
+        request.append("\n");
+        app->TestsToRun.clear();
+    }
+    if (app->OptGuiFunc)
+        request.append("guifunc\n");
+    if (!app->OptExportFilename.empty())
+        request.appendf("export %s\n", app->OptExportFilename.c_str());
+    request.append("\n");
+    for (const char* p = request.c_str(), *p_end = p + request.length(); p < p_end; )
+    {
+        ssize_t sent = send(fd, p, (size_t)(p_end - p), 0);
+        if (sent <= 0)
+            break;
+        p += sent;
+    }
+
+    // Relay output, keeping track of start of last line to read the final result
+    Str256 last_line;
+    bool at_line_start = true;
+    char buf[4096];
+    ssize_t len;
+    while ((len = recv(fd, buf, sizeof(buf), 0)) > 0)
+    {
+        fwrite(buf, 1, (size_t)len, stdout);
+        for (ssize_t n = 0; n < len; n++)
+        {
+            if (at_line_start && buf[n] != '\n')
+                last_line.clear();
+            at_line_start = (buf[n] == '\n');
+            if (!at_line_start && last_line.length() < 16)
+                last_line.append(buf + n, buf + n + 1);
+        }
+    }
+    close(fd);
+    fflush(stdout);
+
+    if (strncmp(last_line.c_str(), "result ok", 9) == 0)
+        return ImGuiTestAppErrorCode_Success;
+    return ImGuiTestAppErrorCode_TestFailed;
+}
+
+#endif // #if IMGUI_TEST_SUITE_ENABLE_SERVER
+
 // Win32 Debug CRT to help catch leaks. Replace parameter in main()'s 'DebugCrtInit(0)' call to track a given allocation from the ID given in leak report.
 #ifdef DEBUG_CRT
 static inline void DebugCrtInit(long break_alloc)
@@ -444,6 +884,27 @@ int main(int argc, char** argv)
     }
     argv = nullptr;
 
+#if IMGUI_TEST_SUITE_ENABLE_SERVER
+    // Client mode: forward queued tests to a resident instance
+    if (!app->OptConnectSocket.empty())
+        return TestSuite_ClientRun(app);
+#endif
+
+    // Server mode: keep running headless, restore UI state between requests
+    if (!app->OptServerSocket.empty())
+    {
+        app->OptGui = false;
+        app->OptPauseOnExit = false;
+        app->OptRestoreUiState = true;
+    }
+
+    // Fork isolation: child processes run the app frame loop, they can't share a window or graphics context with parent
+    if (app->OptForkIsolation && app->OptGui)
+    {
+        fprintf(stderr, "-fork requires -nogui.\n");
+        return ImGuiTestAppErrorCode_CommandLineError;
+    }
+
     // Default verbose levels differs whether we are in in GUI or Command-Line mode
     if (app->OptGui)
     {
@@ -503,10 +964,19 @@ int main(int argc, char** argv)
     // Apply Options to TestEngine
     ImGuiTestEngineIO& test_io = ImGuiTestEngine_GetIO(engine);
     test_io.ConfigRunSpeed = app->OptRunSpeed;
+    test_io.ConfigVirtualTime = app->OptVirtualTime;
     test_io.ConfigVerboseLevel = app->OptVerboseLevelBasic;
     test_io.ConfigVerboseLevelOnError = app->OptVerboseLevelError;
     test_io.ConfigNoThrottle = app->OptNoThrottle;
     test_io.PerfStressAmount = app->OptStressAmount;
+    test_io.PerfStressSweepSteps = app->OptStressSweepSteps;
+    test_io.ConfigPerfCounters = app->OptPerfCounters;
+    test_io.ConfigPerfCpuTime = app->OptPerfCpuTime;
+    test_io.ConfigFastInputCoalescing = app->OptFastInputCoalescing;
+    test_io.ConfigKeyCharsPerFrame = app->OptKeyCharsPerFrame;
+    test_io.ConfigRestoreUiStateBetweenTests = app->OptRestoreUiState;
+    test_io.ConfigItemGraph = app->OptItemGraph;
+    test_io.ConfigForkIsolation = app->OptForkIsolation;
     test_io.ConfigCaptureEnabled = app->OptCaptureEnabled;
     FindVideoEncoder(test_io.VideoCaptureEncoderPath, IM_COUNTOF(test_io.VideoCaptureEncoderPath));
     ImStrncpy(test_io.VideoCaptureEncoderParams, IMGUI_CAPTURE_DEFAULT_VIDEO_PARAMS_FOR_FFMPEG, IM_COUNTOF(test_io.VideoCaptureEncoderParams));
@@ -566,7 +1036,8 @@ int main(int argc, char** argv)
     if (app->OptGuiFunc)
         test_run_flags |= ImGuiTestRunFlags_GuiFuncOnly;
     TestSuite_QueueTests(app, test_run_flags);
-    const bool exit_after_tests = !ImGuiTestEngine_IsTestQueueEmpty(engine) && !app->OptPauseOnExit;
+    const bool server_mode = !app->OptServerSocket.empty();
+    const bool exit_after_tests = !ImGuiTestEngine_IsTestQueueEmpty(engine) && !app->OptPauseOnExit && !server_mode;
 
     // Retrieve Git branch name, store in annotation field by default
     Str64 git_repo_path;
@@ -594,6 +1065,13 @@ int main(int argc, char** argv)
     // Start engine
     ImGuiTestEngine_Start(engine, ImGui::GetCurrentContext());
     ImGuiTestEngine_InstallDefaultCrashHandler();
+#if IMGUI_TEST_SUITE_ENABLE_SERVER
+    if (server_mode && !TestSuite_ServerStart(app))
+    {
+        ImGuiTestEngine_Stop(engine);
+        return ImGuiTestAppErrorCode_CommandLineError;
+    }
+#endif
 
     // Setup scaling
     const float main_scale = (app->OptScale != 0.0f) ? app->OptScale : app_window->DpiScale; // Override with e.g. '-scale 1.75' command-line param.
@@ -625,6 +1103,17 @@ int main(int argc, char** argv)
         if (exit_after_tests && ImGuiTestEngine_IsTestQueueEmpty(engine))
             break;
 
+#if IMGUI_TEST_SUITE_ENABLE_SERVER
+        if (server_mode)
+        {
+            TestSuite_ServerUpdate(app);
+            if (app->Server.QuitRequested)
+                break;
+            if (!test_io.IsRunningTests && ImGuiTestEngine_IsTestQueueEmpty(engine))
+                ImThreadSleepInMilliseconds(5); // Idle: avoid spinning while waiting for requests
+        }
+#endif
+
         ImGui::NewFrame();
         TestSuite_ShowUI(app);
 
@@ -637,7 +1126,7 @@ int main(int argc, char** argv)
 
         ImGui::Render();
 
-        if (!app->OptGui && !test_io.IsRunningTests)
+        if (!app->OptGui && !test_io.IsRunningTests && !server_mode)
             break;
 
         app_window->Vsync = test_io.IsRequestingMaxAppSpeed ? false : true;
@@ -650,6 +1139,10 @@ int main(int argc, char** argv)
         ImGuiTestEngine_PostSwap(engine);
     }
 
+#if IMGUI_TEST_SUITE_ENABLE_SERVER
+    if (server_mode)
+        TestSuite_ServerStop(app);
+#endif
     ImGuiTestEngine_Stop(engine);
 
     // Print results (command-line mode)
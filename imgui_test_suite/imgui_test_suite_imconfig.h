@@ -33,6 +33,9 @@
 // In your own application you may want to implement them using your own facilities (own thread or coroutine)
 #define IMGUI_TEST_ENGINE_ENABLE_COROUTINE_STDTHREAD_IMPL 1
 
+// Format exported results (-export) over multiple threads
+#define IMGUI_TEST_ENGINE_ENABLE_EXPORT_THREADS 1
+
 // Enable plotting of perflog data for comparing performance of different runs. This feature requires ImPlot.
 #ifndef IMGUI_TEST_ENGINE_ENABLE_IMPLOT
 #define IMGUI_TEST_ENGINE_ENABLE_IMPLOT 1
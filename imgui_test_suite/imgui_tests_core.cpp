@@ -10,6 +10,8 @@
 #include "imgui_test_engine/imgui_te_engine.h"      // IM_REGISTER_TEST()
 #include "imgui_test_engine/imgui_te_context.h"
 #include "imgui_test_engine/imgui_te_utils.h"       // ImHashDecoratedPath()
+#include "imgui_test_engine/imgui_te_exporters.h"   // ImGuiTestEngine_ExportEx()
+#include "imgui_test_engine/imgui_te_perftool.h"    // ImGuiTestEngine_PerfToolFitScaling()
 #include "imgui_test_engine/imgui_capture_tool.h"
 #include "imgui_test_engine/thirdparty/Str/Str.h"
 #if IMGUI_TEST_ENGINE_ENABLE_IMPLOT
@@ -7298,6 +7300,19 @@ void RegisterTests_TestEngine(ImGuiTestEngine* e)
         IM_CHECK_EQ(ImHashDecoratedPath("Hello\\/world"), ImHashStr("Hello/world"));         // Slashes can be inhibited
         IM_CHECK_EQ(ImHashDecoratedPath("//Hello", NULL, 42), ImHashDecoratedPath("Hello")); // Leading / clears seed
 
+        // Verify compile-time hashing
+        constexpr ImGuiID constexpr_id_1 = ImHashDecoratedPathConstexpr("Hello/world");
+        constexpr ImGuiID constexpr_id_2 = ImHashDecoratedPathConstexpr("//Hello\\/world", 42);
+        constexpr ImGuiID constexpr_id_3 = ImHashDecoratedPathConstexpr("Hello/world###Blah", 42);
+        IM_CHECK_EQ(constexpr_id_1, ImHashDecoratedPath("Hello/world"));
+        IM_CHECK_EQ(constexpr_id_2, ImHashDecoratedPath("Hello\\/world"));
+        IM_CHECK_EQ(constexpr_id_3, ImHashDecoratedPath("Hello/world###Blah", NULL, 42));
+
+        // Verify that bulk hashing of long runs (SIMD scan + hardware CRC32C when available) matches byte-by-byte hashing
+        IM_CHECK_EQ(ImHashDecoratedPath("A rather long label for a window/and a long label for its item"), ImHashStr("A rather long label for a windowand a long label for its item"));
+        IM_CHECK_EQ(ImHashDecoratedPath("0123456789abcdef0123456789abcdef\\/x"), ImHashStr("0123456789abcdef0123456789abcdef/x"));
+        IM_CHECK_EQ(ImHashDecoratedPath("0123456789abcde/$$1/0123456789abcdef0", NULL, 42), ImHashStr("0123456789abcdef0", 0, ImHashDecoratedPath("0123456789abcde/$$1", NULL, 42)));
+
         // Verify that ### reset to the last slash
         IM_CHECK_EQ(ImHashDecoratedPath("Hello/world###Blah"), ImHashStr("###Blah", 0, ImHashStr("Hello")));
 
@@ -7568,6 +7583,957 @@ void RegisterTests_TestEngine(ImGuiTestEngine* e)
         ctx->MouseClick();
     };
 
+    // ## Test ItemFuzz() coverage and determinism
+    t = IM_REGISTER_TEST(e, "testengine", "testengine_item_fuzz");
+    t->GuiFunc = [](ImGuiTestContext* ctx)
+    {
+        auto& vars = ctx->GenericVars;
+        ImGui::SetNextWindowPos(ImVec2(100, 100), ImGuiCond_Always);
+        ImGui::SetNextWindowSize(ImVec2(300, 300), ImGuiCond_Always);
+        ImGui::Begin("Test Window", NULL, ImGuiWindowFlags_NoSavedSettings | ImGuiWindowFlags_NoMove | ImGuiWindowFlags_NoResize | ImGuiWindowFlags_NoCollapse);
+        if (ImGui::Button("Button"))
+            vars.Count++;
+        ImGui::Checkbox("Checkbox", &vars.Bool1);
+        ImGui::SliderInt("Slider", &vars.Int1, 0, 100);
+        ImGui::InputText("Field", vars.Str1, IM_ARRAYSIZE(vars.Str1));
+        if (ImGui::Button("Open Popup"))
+            ImGui::OpenPopup("Popup");
+        if (ImGui::BeginPopup("Popup"))
+        {
+            ImGui::MenuItem("Item A");
+            ImGui::MenuItem("Item B");
+            ImGui::EndPopup();
+        }
+        ImGui::End();
+    };
+    t->TestFunc = [](ImGuiTestContext* ctx)
+    {
+        // Run twice with same seed from same initial state, then with another seed
+        const ImU32 seeds[3] = { 0x1234, 0x1234, 0x5678 };
+        ImGuiTestFuzzResult results[3];
+        for (int run_n = 0; run_n < 3; run_n++)
+        {
+            ctx->PopupCloseAll();
+            ctx->KeyPress(ImGuiKey_Escape); // Deactivate text field
+            ctx->GenericVars.Clear();
+            ctx->MouseMoveToVoid();
+            ctx->WindowFocus("//Test Window");
+            ctx->Yield();
+
+            ImGuiTestFuzzOptions options;
+            options.Seed = seeds[run_n];
+            options.ActionsCount = 100;
+            ImGuiTestFuzzResult& result = results[run_n];
+            result = ctx->ItemFuzz("Test Window", &options);
+            IM_CHECK_EQ(result.FailedAction, -1);
+            IM_CHECK_EQ(result.ErrorsRecovered, 0);
+            IM_CHECK_EQ(result.ActionsCount, options.ActionsCount);
+            IM_CHECK_GE(result.ItemsSeen, 5);
+            IM_CHECK_GE(result.FramesCount, result.ActionsCount);
+            ctx->LogInfo("ItemFuzz throughput: %.0f actions/sec, %.2f frames/action, %.0f frames/sec", (double)result.ActionsCount * 1000000.0 / (double)ImMax(result.TimeUs, (ImU64)1),
+                (double)result.FramesCount / result.ActionsCount, (double)result.FramesCount * 1000000.0 / (double)ImMax(result.TimeUs, (ImU64)1));
+        }
+        IM_CHECK_EQ(results[0].ActionsHash, results[1].ActionsHash);
+        IM_CHECK_EQ(results[0].ItemsSeen, results[1].ItemsSeen);
+        IM_CHECK_EQ(results[0].WindowsSeen, results[1].WindowsSeen);
+        IM_CHECK_NE(results[0].ActionsHash, results[2].ActionsHash);
+    };
+
+    // ## Test input recording encoding and replay
+    t = IM_REGISTER_TEST(e, "testengine", "testengine_input_replay");
+    t->GuiFunc = [](ImGuiTestContext* ctx)
+    {
+        auto& vars = ctx->GenericVars;
+        ImGui::Begin("Test Window", NULL, ImGuiWindowFlags_NoSavedSettings | ImGuiWindowFlags_AlwaysAutoResize);
+        if (ImGui::Button("Button"))
+            vars.Count++;
+        ImGui::InputText("Field", vars.Str1, IM_ARRAYSIZE(vars.Str1));
+        ImGui::End();
+    };
+    t->TestFunc = [](ImGuiTestContext* ctx)
+    {
+        auto& vars = ctx->GenericVars;
+        ctx->SetRef("Test Window");
+        ImGuiTestItemInfo button = ctx->ItemInfo("Button");
+        ImGuiTestItemInfo field = ctx->ItemInfo("Field");
+        ctx->MouseMoveToVoid();
+
+        // Build a recording as a backend would submit it: idle frames, one event per frame, and press+release in a same frame.
+        ImGuiTestInputRecording recording;
+        ImGuiInputEvent ev;
+        auto add_mouse_pos = [&](ImVec2 pos) { ev = ImGuiInputEvent(); ev.Type = ImGuiInputEventType_MousePos; ev.Source = ImGuiInputSource_Mouse; ev.MousePos.PosX = pos.x; ev.MousePos.PosY = pos.y; recording.AddEvent(&ev); };
+        auto add_mouse_button = [&](bool down) { ev = ImGuiInputEvent(); ev.Type = ImGuiInputEventType_MouseButton; ev.Source = ImGuiInputSource_Mouse; ev.MouseButton.Button = 0; ev.MouseButton.Down = down; recording.AddEvent(&ev); };
+        auto add_char = [&](char c) { ev = ImGuiInputEvent(); ev.Type = ImGuiInputEventType_Text; ev.Source = ImGuiInputSource_Keyboard; ev.Text.Char = (unsigned int)c; recording.AddEvent(&ev); };
+        recording.AddFrame(1.0f / 60.0f);
+        add_mouse_pos(button.RectFull.GetCenter());
+        recording.AddFrame(1.0f / 60.0f);
+        recording.AddFrame(1.0f / 60.0f);
+        add_mouse_button(true);
+        recording.AddFrame(1.0f / 60.0f);
+        add_mouse_button(false);
+        recording.AddFrame(1.0f / 60.0f);
+        add_mouse_button(true);
+        add_mouse_button(false);
+        recording.AddFrame(1.0f / 60.0f);
+        add_mouse_pos(field.RectFull.GetCenter());
+        add_mouse_button(true);
+        add_mouse_button(false);
+        recording.AddFrame(1.0f / 60.0f);
+        add_char('a');
+        add_char('b');
+        recording.AddFrame(1.0f / 60.0f);
+        recording.Finish();
+        IM_CHECK_EQ(recording.FrameCount, 8);
+        IM_CHECK_EQ(recording.EventCount, 10);
+
+        // Decoding
+        ImGuiTestInputRecordingReader reader(&recording);
+        IM_CHECK(reader.ReadFrame());
+        IM_CHECK_EQ(reader.FrameCount, 1);
+        IM_CHECK_EQ(reader.Events.Size, 1);
+        IM_CHECK(reader.Events[0].Type == ImGuiInputEventType_MousePos);
+        IM_CHECK_LE(ImFabs(reader.Events[0].MousePos.PosX - button.RectFull.GetCenter().x), 1.0f / 32.0f); // Stored in 1/16th of pixels
+        IM_CHECK_LE(ImFabs(reader.Events[0].MousePos.PosY - button.RectFull.GetCenter().y), 1.0f / 32.0f);
+        IM_CHECK(reader.ReadFrame());
+        IM_CHECK_EQ(reader.FrameCount, 2);
+        IM_CHECK_EQ(reader.Events.Size, 1);
+        IM_CHECK(reader.Events[0].Type == ImGuiInputEventType_MouseButton);
+        IM_CHECK(reader.Events[0].MouseButton.Down == true);
+
+        // Replay
+        vars.Count = 0;
+        const int frame_count_start = ctx->FrameCount;
+        ctx->InputReplay(&recording);
+        IM_CHECK_GE(ctx->FrameCount - frame_count_start, recording.FrameCount);
+        IM_CHECK_EQ(vars.Count, 2);
+        IM_CHECK_STR_EQ(vars.Str1, "ab");
+    };
+
+    // ## Test scaling fit used when sweeping PerfStressAmount
+    t = IM_REGISTER_TEST(e, "testengine", "testengine_perftool_fit_scaling");
+    t->TestFunc = [](ImGuiTestContext* ctx)
+    {
+        IM_UNUSED(ctx);
+        const int stress_amounts[] = { 1, 2, 4, 8, 16 };
+        double dt_linear[IM_ARRAYSIZE(stress_amounts)];
+        double dt_quadratic[IM_ARRAYSIZE(stress_amounts)];
+        for (int n = 0; n < IM_ARRAYSIZE(stress_amounts); n++)
+        {
+            dt_linear[n] = 0.05 * stress_amounts[n];
+            dt_quadratic[n] = 0.01 * stress_amounts[n] * stress_amounts[n];
+        }
+
+        double exponent = 0.0, cost_ms = 0.0;
+        IM_CHECK(ImGuiTestEngine_PerfToolFitScaling(stress_amounts, dt_linear, IM_ARRAYSIZE(stress_amounts), &exponent, &cost_ms));
+        IM_CHECK_LE(ImAbs(exponent - 1.0), 0.001);
+        IM_CHECK_LE(ImAbs(cost_ms - 0.05), 0.0001);
+        IM_CHECK(ImGuiTestEngine_PerfToolFitScaling(stress_amounts, dt_quadratic, IM_ARRAYSIZE(stress_amounts), &exponent, &cost_ms));
+        IM_CHECK_LE(ImAbs(exponent - 2.0), 0.001);
+
+        // Non-positive results are ignored by exponent fit, a single stress amount can't be fitted.
+        const double dt_noisy[] = { -0.01, 0.0, 0.2, 0.4, 0.8 };
+        IM_CHECK(ImGuiTestEngine_PerfToolFitScaling(stress_amounts, dt_noisy, IM_ARRAYSIZE(stress_amounts), &exponent, &cost_ms));
+        IM_CHECK_LE(ImAbs(exponent - 1.0), 0.001);
+        const int stress_amounts_same[] = { 4, 4, 4 };
+        IM_CHECK(!ImGuiTestEngine_PerfToolFitScaling(stress_amounts_same, dt_linear, IM_ARRAYSIZE(stress_amounts_same), &exponent, &cost_ms));
+    };
+
+    // ## Test PerfTool aggregation: pre-aggregated builds give same results as aggregating runs, test names with a same hash are not merged
+    t = IM_REGISTER_TEST(e, "testengine", "testengine_perftool_aggregates");
+    t->TestFunc = [](ImGuiTestContext* ctx)
+    {
+        const char* test_names[] = { "perf_vcbuvvmu", "perf_hlbfvfshv" };    // Same ImHashStr() value with default CRC32 hash
+        const char* dates[] = { "2026-01-01", "2026-01-02", "2026-01-03" };
+        if (ImHashStr(test_names[0]) != ImHashStr(test_names[1]))
+            ctx->LogInfo("Test names don't have a same hash with this ImHashStr() implementation.");
+
+        ImGuiPerfTool perftool_storage;
+        ImGuiPerfTool* perftool = &perftool_storage;
+        for (int run_n = 0; run_n < IM_COUNTOF(dates); run_n++)
+            for (int test_n = 0; test_n < IM_COUNTOF(test_names); test_n++)
+            {
+                ImGuiPerfToolEntry entry;
+                entry.Timestamp = 1000 + run_n;
+                entry.Category = "perf";
+                entry.TestName = test_names[test_n];
+                entry.DtDeltaMs = 1.0 + run_n + test_n * 10.0;
+                entry.GitBranchName = "master";
+                entry.BuildType = "Release";
+                entry.Cpu = "X64";
+                entry.OS = "Linux";
+                entry.Compiler = "GCC";
+                entry.Date = dates[run_n];
+                perftool->AddEntry(&entry);
+            }
+
+        // All runs visible: batch uses pre-aggregated build
+        perftool->_DisplayType = ImGuiPerfToolDisplayType_CombineByBuildInfo;
+        perftool->_Rebuild();
+        IM_CHECK_EQ(perftool->_SrcLabels.Size, 2);
+        IM_CHECK_EQ(perftool->_SrcBuilds.Size, 1);
+        IM_CHECK_EQ(perftool->_Batches.Size, 1);
+        IM_CHECK_EQ(perftool->_Batches[0].NumSamples, 3);
+        for (int test_n = 0; test_n < IM_COUNTOF(test_names); test_n++)
+        {
+            ImGuiPerfToolEntry* entry = perftool->GetEntryByBatchIdx(0, test_names[test_n]);
+            IM_CHECK_SILENT(entry != nullptr);
+            IM_CHECK_EQ(entry->NumSamples, 3);
+            IM_CHECK_EQ(entry->DtDeltaMs, 2.0 + test_n * 10.0);
+            IM_CHECK_EQ(entry->DtDeltaMsMin, 1.0 + test_n * 10.0);
+            IM_CHECK_EQ(entry->DtDeltaMsMax, 3.0 + test_n * 10.0);
+        }
+
+        // First run filtered out: batch aggregates remaining runs
+        ImStrncpy(perftool->_FilterDateFrom, dates[1], IM_COUNTOF(perftool->_FilterDateFrom));
+        perftool->_Rebuild();
+        IM_CHECK_EQ(perftool->_Batches.Size, 1);
+        IM_CHECK_EQ(perftool->_Batches[0].NumSamples, 2);
+        for (int test_n = 0; test_n < IM_COUNTOF(test_names); test_n++)
+        {
+            ImGuiPerfToolEntry* entry = perftool->GetEntryByBatchIdx(0, test_names[test_n]);
+            IM_CHECK_SILENT(entry != nullptr);
+            IM_CHECK_EQ(entry->NumSamples, 2);
+            IM_CHECK_EQ(entry->DtDeltaMs, 2.5 + test_n * 10.0);
+        }
+
+        // One batch per run
+        perftool->_DisplayType = ImGuiPerfToolDisplayType_Simple;
+        perftool->_Rebuild();
+        IM_CHECK_EQ(perftool->_Batches.Size, 2);
+    };
+
+    // ## Test that compressed fast mode (ConfigFastInputCoalescing) delivers the same clicks and key presses in fewer frames
+    t = IM_REGISTER_TEST(e, "testengine", "testengine_fast_input_coalescing");
+    t->GuiFunc = [](ImGuiTestContext* ctx)
+    {
+        ImGuiTestGenericVars& vars = ctx->GenericVars;
+        ImGui::SetNextWindowSize(ImVec2(200, 100), ImGuiCond_Appearing);
+        ImGui::Begin("Test Window", NULL, ImGuiWindowFlags_NoSavedSettings);
+        if (ImGui::Button("Button"))
+            vars.Count++;
+        if (ImGui::IsItemHovered() && ImGui::IsMouseDoubleClicked(0))
+            vars.Int1++;
+        if (ImGui::IsKeyPressed(ImGuiKey_A, false))
+            vars.Int2++;
+        ImGui::End();
+    };
+    t->TestFunc = [](ImGuiTestContext* ctx)
+    {
+        if (ctx->EngineIO->ConfigRunSpeed != ImGuiTestRunSpeed_Fast || !ctx->UiContext->IO.ConfigInputTrickleEventQueue)
+            return;
+
+        ImGuiTestGenericVars& vars = ctx->GenericVars;
+        const bool backup_coalescing = ctx->EngineIO->ConfigFastInputCoalescing;
+        int frames_click[2], frames_double_click[2], frames_key[2];
+        for (int coalescing = 0; coalescing < 2; coalescing++)
+        {
+            ctx->EngineIO->ConfigFastInputCoalescing = (coalescing != 0);
+            ctx->SetRef("Test Window");
+            ctx->MouseMove("Button");
+            vars.Count = vars.Int1 = vars.Int2 = 0;
+
+            int frame_start = ctx->FrameCount;
+            ctx->MouseClick(0);
+            frames_click[coalescing] = ctx->FrameCount - frame_start;
+            IM_CHECK_EQ(vars.Count, 1);
+            IM_CHECK_EQ(vars.Int1, 0);
+
+            frame_start = ctx->FrameCount;
+            ctx->MouseDoubleClick(0);
+            frames_double_click[coalescing] = ctx->FrameCount - frame_start;
+            IM_CHECK_EQ(vars.Int1, 1);
+
+            frame_start = ctx->FrameCount;
+            ctx->KeyPress(ImGuiKey_A, 3);
+            frames_key[coalescing] = ctx->FrameCount - frame_start;
+            IM_CHECK_EQ(vars.Int2, 3);
+        }
+        ctx->EngineIO->ConfigFastInputCoalescing = backup_coalescing;
+
+        ctx->LogDebug("Frames: MouseClick %d -> %d, MouseDoubleClick %d -> %d, KeyPress x3 %d -> %d",
+            frames_click[0], frames_click[1], frames_double_click[0], frames_double_click[1], frames_key[0], frames_key[1]);
+        IM_CHECK_LT(frames_click[1], frames_click[0]);
+        IM_CHECK_LT(frames_double_click[1], frames_double_click[0]);
+        IM_CHECK_LT(frames_key[1], frames_key[0]);
+    };
+
+    // ## Test simulated clock (ImGuiTestEngineIO::ConfigVirtualTime) in Normal run speed: Dear ImGui time advances by
+    // ConfigVirtualTimeStep per frame while wall clock time stays well below slept duration. Disabling it restores real time.
+    struct TestEngineVirtualTimeVars { ImGuiTestRunSpeed BackupRunSpeed = ImGuiTestRunSpeed_Fast; bool BackupVirtualTime = false; float BackupVirtualTimeStep = 0.0f; };
+    static TestEngineVirtualTimeVars virtual_time_vars;
+    t = IM_REGISTER_TEST(e, "testengine", "testengine_virtual_time");
+    t->TestFunc = [](ImGuiTestContext* ctx)
+    {
+        TestEngineVirtualTimeVars& vars = virtual_time_vars;
+        vars.BackupRunSpeed = ctx->EngineIO->ConfigRunSpeed;
+        vars.BackupVirtualTime = ctx->EngineIO->ConfigVirtualTime;
+        vars.BackupVirtualTimeStep = ctx->EngineIO->ConfigVirtualTimeStep;
+        ctx->EngineIO->ConfigRunSpeed = ImGuiTestRunSpeed_Normal;
+        ctx->EngineIO->ConfigVirtualTime = true;
+        ctx->EngineIO->ConfigVirtualTimeStep = 1.0f / 60.0f;
+        ctx->Yield();   // Next frame uses virtual time
+
+        // Sleep(): 5 simulated seconds, each frame advancing by ConfigVirtualTimeStep
+        double time_start = ImGui::GetTime();
+        ImU64 wall_start = ImTimeGetInMicroseconds();
+        ctx->Sleep(5.0f);
+        double time_elapsed = ImGui::GetTime() - time_start;
+        double wall_elapsed = (double)(ImTimeGetInMicroseconds() - wall_start) / 1000000.0;
+        ctx->LogInfo("Virtual time: Sleep(5.0) -> %.3f s simulated in %.3f s wall clock", time_elapsed, wall_elapsed);
+        IM_CHECK_EQ(ctx->UiContext->IO.DeltaTime, 1.0f / 60.0f);
+        IM_CHECK_GE(time_elapsed, 5.0 - 0.001);
+        IM_CHECK_LE(time_elapsed, 5.0 + 1.0 / 60.0 + 0.001);
+        IM_CHECK_LT(wall_elapsed, 2.5);
+
+        // SleepNoSkip(): requested step overrides ConfigVirtualTimeStep
+        time_start = ImGui::GetTime();
+        wall_start = ImTimeGetInMicroseconds();
+        const int frame_start = ctx->FrameCount;
+        ctx->SleepNoSkip(2.0f, 0.25f);
+        time_elapsed = ImGui::GetTime() - time_start;
+        wall_elapsed = (double)(ImTimeGetInMicroseconds() - wall_start) / 1000000.0;
+        IM_CHECK_EQ(ctx->UiContext->IO.DeltaTime, 0.25f);
+        IM_CHECK_EQ(ctx->FrameCount - frame_start, 8);
+        IM_CHECK_GE(time_elapsed, 2.0 - 0.001);
+        IM_CHECK_LT(wall_elapsed, 1.0);
+
+        // Disabled: Sleep() takes as long in wall clock time as it advances Dear ImGui time
+        ctx->EngineIO->ConfigVirtualTime = false;
+        ctx->Yield();
+        time_start = ImGui::GetTime();
+        wall_start = ImTimeGetInMicroseconds();
+        ctx->Sleep(0.5f);
+        time_elapsed = ImGui::GetTime() - time_start;
+        wall_elapsed = (double)(ImTimeGetInMicroseconds() - wall_start) / 1000000.0;
+        ctx->LogInfo("Real time: Sleep(0.5) -> %.3f s in %.3f s wall clock", time_elapsed, wall_elapsed);
+        IM_CHECK_GE(time_elapsed, 0.5 - 0.001);
+        IM_CHECK_GE(wall_elapsed, time_elapsed - 0.1);  // Tolerance for delta time of frames straddling start/end of measure
+    };
+    t->TeardownFunc = [](ImGuiTestContext* ctx)
+    {
+        TestEngineVirtualTimeVars& vars = virtual_time_vars;
+        ctx->EngineIO->ConfigRunSpeed = vars.BackupRunSpeed;
+        ctx->EngineIO->ConfigVirtualTime = vars.BackupVirtualTime;
+        ctx->EngineIO->ConfigVirtualTimeStep = vars.BackupVirtualTimeStep;
+    };
+
+    // ## Test accounting of frames per context function (ImGuiTestOutput::ActionStats)
+    t = IM_REGISTER_TEST(e, "testengine", "testengine_action_stats");
+    t->GuiFunc = [](ImGuiTestContext* ctx)
+    {
+        ImGui::SetNextWindowSize(ImVec2(200, 100), ImGuiCond_Appearing);
+        ImGui::Begin("Test Window", NULL, ImGuiWindowFlags_NoSavedSettings);
+        if (ImGui::Button("Button"))
+            ctx->GenericVars.Count++;
+        ImGui::End();
+    };
+    t->TestFunc = [](ImGuiTestContext* ctx)
+    {
+        ctx->SetRef("Test Window");
+        ctx->ItemClick("Button");
+        ctx->ItemClick("Button");
+        IM_CHECK_EQ(ctx->GenericVars.Count, 2);
+
+        const ImGuiTestActionStats* stats_click = NULL;
+        const ImGuiTestActionStats* stats_action = NULL;
+        for (const ImGuiTestActionStats& stats : ctx->TestOutput->ActionStats)
+        {
+            if (strstr(stats.Name, "MouseClickMulti") != NULL)
+                stats_click = &stats;
+            if (strstr(stats.Name, "ItemAction") != NULL)
+                stats_action = &stats;
+        }
+        IM_CHECK(stats_click != NULL && stats_action != NULL);
+        IM_CHECK_EQ(stats_click->Calls, 2);
+        IM_CHECK_EQ(stats_action->Calls, 2);
+        IM_CHECK_GE(stats_click->Frames, 2 * 3);
+        IM_CHECK_GT(stats_action->Frames, stats_click->Frames);     // Includes nested calls
+        IM_CHECK_GE(ctx->TestOutput->ActionFrames, stats_action->Frames);
+        for (const ImGuiTestActionStats& stats : ctx->TestOutput->ActionStats)
+            IM_CHECK_NO_RET(&stats == stats_click || stats.Name != stats_click->Name); // One entry per function
+    };
+
+    // ## Test in-memory snapshot/restore of windows, tables and docking state (ImGuiTestEngineIO::ConfigRestoreUiStateBetweenTests)
+    // First test enables it and queues the two others: state modified by _1 is gone when starting _2.
+    struct TestEngineRestoreUiStateVars { bool Enabled = false; bool BackupConfig = false; ImVec2 Pos, Size; };
+    static TestEngineRestoreUiStateVars restore_ui_state_vars;
+    auto restore_ui_state_gui = [](ImGuiTestContext* ctx)
+    {
+        IM_UNUSED(ctx);
+        ImGui::SetNextWindowSize(ImVec2(300, 200), ImGuiCond_Appearing);
+        ImGui::Begin("Test Window");
+        if (ImGui::BeginTable("table1", 3, ImGuiTableFlags_Resizable | ImGuiTableFlags_Reorderable | ImGuiTableFlags_Hideable))
+        {
+            ImGui::TableSetupColumn("One");
+            ImGui::TableSetupColumn("Two");
+            ImGui::TableSetupColumn("Three");
+            ImGui::TableHeadersRow();
+            ImGui::EndTable();
+        }
+        ImGui::End();
+#ifdef IMGUI_HAS_DOCK
+        ImGui::SetNextWindowSize(ImVec2(200, 100), ImGuiCond_Appearing);
+        ImGui::Begin("Test Window 2");
+        ImGui::End();
+#endif
+    };
+    t = IM_REGISTER_TEST(e, "testengine", "testengine_restore_ui_state");
+    t->GuiFunc = restore_ui_state_gui;
+    t->TestFunc = [](ImGuiTestContext* ctx)
+    {
+        if (ctx->EngineIO->ConfigRestoreUiStateBetweenTests)
+        {
+            ctx->LogInfo("Skipped: already enabled, windows created by this test are not part of the snapshot.");
+            return;
+        }
+
+        ctx->SetRef("Test Window");
+        ctx->WindowMove("", ImVec2(100, 100));
+        ctx->WindowResize("", ImVec2(300, 200));
+        ctx->TableSetColumnEnabled("table1", "Two", true);
+#ifdef IMGUI_HAS_DOCK
+        ctx->DockClear("Test Window", "Test Window 2", NULL);
+#endif
+        ImGuiWindow* window = ctx->GetWindowByRef("");
+        IM_CHECK_SILENT(window != NULL);
+
+        // Snapshot will be captured when starting next test
+        TestEngineRestoreUiStateVars& vars = restore_ui_state_vars;
+        vars.Enabled = true;
+        vars.BackupConfig = ctx->EngineIO->ConfigRestoreUiStateBetweenTests;
+        vars.Pos = window->Pos;
+        vars.Size = window->Size;
+        ctx->EngineIO->ConfigRestoreUiStateBetweenTests = true;
+        ImGuiTestEngine_QueueTest(ctx->Engine, ImGuiTestEngine_FindTestByName(ctx->Engine, "testengine", "testengine_restore_ui_state_1"), ctx->RunFlags);
+        ImGuiTestEngine_QueueTest(ctx->Engine, ImGuiTestEngine_FindTestByName(ctx->Engine, "testengine", "testengine_restore_ui_state_2"), ctx->RunFlags);
+    };
+    t = IM_REGISTER_TEST(e, "testengine", "testengine_restore_ui_state_1");
+    t->GuiFunc = restore_ui_state_gui;
+    t->TestFunc = [](ImGuiTestContext* ctx)
+    {
+        if (!restore_ui_state_vars.Enabled)
+            return;
+        ctx->SetRef("Test Window");
+        ctx->WindowMove("", ImVec2(150, 120));
+        ctx->WindowResize("", ImVec2(250, 150));
+        ctx->TableSetColumnEnabled("table1", "Two", false);
+        ImGuiWindow* window = ctx->GetWindowByRef("");
+        ImGuiTable* table = ImGui::TableFindByID(ctx->GetID("table1"));
+        IM_CHECK_SILENT(window != NULL && table != NULL);
+        IM_CHECK(window->Pos != restore_ui_state_vars.Pos);
+        IM_CHECK(!table->Columns[1].IsEnabled);
+#ifdef IMGUI_HAS_DOCK
+        ctx->DockInto("//Test Window 2", "//Test Window");
+        IM_CHECK(window->DockId != 0);
+#endif
+    };
+    t = IM_REGISTER_TEST(e, "testengine", "testengine_restore_ui_state_2");
+    t->GuiFunc = restore_ui_state_gui;
+    t->TestFunc = [](ImGuiTestContext* ctx)
+    {
+        TestEngineRestoreUiStateVars& vars = restore_ui_state_vars;
+        if (!vars.Enabled)
+            return;
+        vars.Enabled = false;
+        ctx->EngineIO->ConfigRestoreUiStateBetweenTests = vars.BackupConfig;
+
+        // Restoring doesn't need extra frames
+        ctx->SetRef("Test Window");
+        ImGuiWindow* window = ctx->GetWindowByRef("");
+        ImGuiTable* table = ImGui::TableFindByID(ctx->GetID("table1"));
+        IM_CHECK_SILENT(window != NULL && table != NULL);
+        IM_CHECK_EQ(window->Pos, vars.Pos);
+        IM_CHECK_EQ(window->Size, vars.Size);
+        IM_CHECK(table->Columns[1].IsEnabled);
+#ifdef IMGUI_HAS_DOCK
+        IM_CHECK_EQ(window->DockId, 0u);
+        IM_CHECK_EQ(ctx->GetWindowByRef("//Test Window 2")->DockId, 0u);
+#endif
+    };
+
+    // ## Test that test contexts and user vars storage are reused across test runs
+    struct TestEnginePooledVars { int Value = 42; };
+    static ImGuiTestContext* pooled_child_ctx = nullptr;
+    static TestEnginePooledVars* pooled_child_vars = nullptr;
+    t = IM_REGISTER_TEST(e, "testengine", "testengine_pooled_context");
+    t->SetVarsDataType<TestEnginePooledVars>();
+    t->TestFunc = [](ImGuiTestContext* ctx)
+    {
+        IM_CHECK_EQ(ctx->GetVars<TestEnginePooledVars>().Value, 42);
+
+        TestEnginePooledVars* vars = &ctx->GetVars<TestEnginePooledVars>();
+        ImGuiTestContext* first_child_ctx = nullptr;
+        TestEnginePooledVars* first_child_vars = nullptr;
+        for (int n = 0; n < 3; n++)
+        {
+            pooled_child_ctx = nullptr;
+            pooled_child_vars = nullptr;
+            IM_CHECK_EQ(ctx->RunChildTest("testengine_pooled_context_child"), ImGuiTestStatus_Success);
+            IM_CHECK_SILENT(pooled_child_ctx != nullptr && pooled_child_vars != nullptr);
+            IM_CHECK(pooled_child_ctx != ctx);
+            if (n == 0)
+            {
+                first_child_ctx = pooled_child_ctx;
+                first_child_vars = pooled_child_vars;
+            }
+            IM_CHECK(pooled_child_ctx == first_child_ctx);      // Same context reused for each run
+            IM_CHECK(pooled_child_vars == first_child_vars);    // Same vars storage reused for each run
+        }
+        IM_CHECK(&ctx->GetVars<TestEnginePooledVars>() == vars); // Our vars didn't move
+        IM_CHECK_EQ(ctx->GetVars<TestEnginePooledVars>().Value, 42);
+    };
+    t = IM_REGISTER_TEST(e, "testengine", "testengine_pooled_context_child");
+    t->SetVarsDataType<TestEnginePooledVars>();
+    t->TestFunc = [](ImGuiTestContext* ctx)
+    {
+        // Pooled context and vars are reset to their default state
+        TestEnginePooledVars& vars = ctx->GetVars<TestEnginePooledVars>();
+        IM_CHECK_EQ(vars.Value, 42);
+        IM_CHECK_EQ(ctx->Clipboard.Size, 0);
+        IM_CHECK_EQ(ctx->GenericVars.Count, 0);
+        vars.Value = 0;
+        ctx->GenericVars.Count++;
+        ImGui::SetClipboardText("Hello");
+        IM_CHECK_STR_EQ(ImGui::GetClipboardText(), "Hello");
+        pooled_child_ctx = ctx;
+        pooled_child_vars = &vars;
+    };
+
+    // ## Test that GatherItems() from item graph returns same results as GatherTask, without yielding
+    t = IM_REGISTER_TEST(e, "testengine", "testengine_item_graph");
+    t->GuiFunc = [](ImGuiTestContext* ctx)
+    {
+        IM_UNUSED(ctx);
+        ImGui::SetNextWindowSize(ImVec2(300, 300), ImGuiCond_Appearing);
+        ImGui::Begin("Test Window");
+        ImGui::Button("A");
+        if (ImGui::TreeNode("Node1"))
+        {
+            ImGui::Button("B");
+            if (ImGui::TreeNode("Node2"))
+            {
+                ImGui::Button("C");
+                ImGui::TreePop();
+            }
+            ImGui::TreePop();
+        }
+        ImGui::BeginChild("Child", ImVec2(100, 100));
+        ImGui::PushID("Group");
+        ImGui::Button("D");
+        ImGui::PopID();
+        ImGui::EndChild();
+        ImGui::End();
+    };
+    t->TestFunc = [](ImGuiTestContext* ctx)
+    {
+        const bool backup_item_graph = ctx->EngineIO->ConfigItemGraph;
+        ctx->SetRef("Test Window");
+        ctx->ItemCloseAll("");
+
+        for (int step = 0; step < 2; step++)
+        {
+            if (step == 1)
+                ctx->ItemOpenAll("");
+
+            ctx->EngineIO->ConfigItemGraph = false;
+            ImGuiTestItemList items_task;
+            ctx->GatherItems(&items_task, "", 99);
+            ImGuiTestItemList items_task_depth1;
+            ctx->GatherItems(&items_task_depth1, "", 1);
+
+            ctx->EngineIO->ConfigItemGraph = true;
+            ctx->Yield(2);
+            const int frame_count = ctx->FrameCount;
+            ImGuiTestItemList items_graph;
+            ctx->GatherItems(&items_graph, "", 99);
+            ImGuiTestItemList items_graph_depth1;
+            ctx->GatherItems(&items_graph_depth1, "", 1);
+            IM_CHECK_EQ(ctx->FrameCount, frame_count);
+
+            IM_CHECK_EQ(items_graph.GetSize(), items_task.GetSize());
+            for (int n = 0; n < items_task.GetSize(); n++)
+            {
+                IM_CHECK_EQ(items_graph.GetByIndex(n)->ID, items_task.GetByIndex(n)->ID);
+                IM_CHECK_EQ(items_graph.GetByIndex(n)->Depth, items_task.GetByIndex(n)->Depth);
+                const ImGuiItemStatusFlags open_flags = ImGuiItemStatusFlags_Openable | ImGuiItemStatusFlags_Opened;
+                IM_CHECK_EQ(items_graph.GetByIndex(n)->StatusFlags & open_flags, items_task.GetByIndex(n)->StatusFlags & open_flags);
+            }
+            IM_CHECK_EQ(items_graph_depth1.GetSize(), items_task_depth1.GetSize());
+            IM_CHECK(items_graph.GetByID(ctx->GetID("Group/D", ctx->WindowInfo("Child").ID)) != nullptr);
+            IM_CHECK_EQ(items_graph.GetByID(ctx->GetID("Node1/Node2/C")) != nullptr, step == 1);
+        }
+
+        // Later passes only process newly appeared items
+        ctx->EngineIO->ConfigItemGraph = true;
+        ctx->ItemCloseAll("");
+        ctx->ItemOpenAll("");
+        IM_CHECK(ctx->ItemIsOpened("Node1/Node2"));
+        ctx->EngineIO->ConfigItemGraph = backup_item_graph;
+    };
+
+    // ## Test gathering items of multiple parents simultaneously
+    t = IM_REGISTER_TEST(e, "testengine", "testengine_gather_multi");
+    t->GuiFunc = [](ImGuiTestContext* ctx)
+    {
+        IM_UNUSED(ctx);
+        ImGui::SetNextWindowPos(ImVec2(100, 100), ImGuiCond_Appearing);
+        ImGui::Begin("Test Window 1", nullptr, ImGuiWindowFlags_NoSavedSettings | ImGuiWindowFlags_AlwaysAutoResize);
+        ImGui::Button("A");
+        ImGui::PushID("Group");
+        ImGui::Button("B");
+        ImGui::Button("C");
+        ImGui::PopID();
+        ImGui::End();
+        ImGui::SetNextWindowPos(ImVec2(300, 100), ImGuiCond_Appearing);
+        ImGui::Begin("Test Window 2", nullptr, ImGuiWindowFlags_NoSavedSettings | ImGuiWindowFlags_AlwaysAutoResize);
+        ImGui::Button("D");
+        ImGui::PushID("Group");
+        ImGui::Button("E");
+        ImGui::PopID();
+        ImGui::End();
+    };
+    t->TestFunc = [](ImGuiTestContext* ctx)
+    {
+        const bool backup_item_graph = ctx->EngineIO->ConfigItemGraph;
+        ctx->EngineIO->ConfigItemGraph = false;
+
+        const ImGuiTestRef parents[] = { "//Test Window 1", "//Test Window 1/Group", "//Test Window 2", "//Test Window 2/Group" };
+        const int expected_sizes[] = { 3, 2, 2, 1 };
+        ImGuiTestItemList single_lists[IM_COUNTOF(parents)];
+        int single_frames = 0;
+        for (int n = 0; n < IM_COUNTOF(parents); n++)
+        {
+            const int frame_count = ctx->FrameCount;
+            ctx->GatherItems(&single_lists[n], parents[n]);
+            single_frames += ctx->FrameCount - frame_count;
+        }
+
+        ImGuiTestItemList multi_lists[IM_COUNTOF(parents)];
+        ImGuiTestItemList* multi_lists_ptrs[IM_COUNTOF(parents)];
+        for (int n = 0; n < IM_COUNTOF(parents); n++)
+            multi_lists_ptrs[n] = &multi_lists[n];
+        const int frame_count = ctx->FrameCount;
+        ctx->GatherItemsMulti(multi_lists_ptrs, parents, IM_COUNTOF(parents));
+        const int multi_frames = ctx->FrameCount - frame_count;
+        IM_CHECK_LT(multi_frames, single_frames);
+
+        for (int n = 0; n < IM_COUNTOF(parents); n++)
+        {
+            IM_CHECK_EQ(multi_lists[n].GetSize(), expected_sizes[n]);
+            IM_CHECK_EQ(multi_lists[n].GetSize(), single_lists[n].GetSize());
+            for (int item_n = 0; item_n < multi_lists[n].GetSize(); item_n++)
+            {
+                IM_CHECK_EQ(multi_lists[n].GetByIndex(item_n)->ID, single_lists[n].GetByIndex(item_n)->ID);
+                IM_CHECK_EQ(multi_lists[n].GetByIndex(item_n)->Depth, single_lists[n].GetByIndex(item_n)->Depth);
+            }
+        }
+        ctx->EngineIO->ConfigItemGraph = backup_item_graph;
+    };
+
+    // ## Test seeking lines in verbose level filtered log
+    t = IM_REGISTER_TEST(e, "testengine", "testengine_log_seek");
+    t->TestFunc = [](ImGuiTestContext* ctx)
+    {
+        ImGuiTestLog log;
+        for (int n = 0; n < 1000; n++)
+        {
+            // Sparse errors, frequent debug lines
+            ImGuiTestVerboseLevel level = (n % 97 == 0) ? ImGuiTestVerboseLevel_Error : (n % 5 == 0) ? ImGuiTestVerboseLevel_Info : ImGuiTestVerboseLevel_Debug;
+            const int prev_size = log.Buffer.size();
+            log.Buffer.appendf("Line %d level %d\n", n, level);
+            log.UpdateLineOffsets(ctx->EngineIO, level, log.Buffer.c_str() + prev_size);
+        }
+        IM_CHECK_EQ(log.LineInfo.Size, 1000);
+
+        for (int level_max = ImGuiTestVerboseLevel_Error; level_max <= ImGuiTestVerboseLevel_Debug; level_max++)
+        {
+            ImGuiTextBuffer expected_text;
+            int filtered_n = 0;
+            for (int line_idx = 0; line_idx < log.LineInfo.Size; line_idx++)
+            {
+                if (log.LineInfo[line_idx].Level > level_max)
+                    continue;
+                IM_CHECK_EQ_NO_RET(log.FindLineIndexForVerboseLevels(ImGuiTestVerboseLevel_Silent, (ImGuiTestVerboseLevel)level_max, filtered_n), line_idx);
+                expected_text.append(log.GetLineBegin(line_idx), log.GetLineEnd(line_idx) + 1);
+                filtered_n++;
+            }
+            IM_CHECK_EQ(log.FindLineIndexForVerboseLevels(ImGuiTestVerboseLevel_Silent, (ImGuiTestVerboseLevel)level_max, filtered_n), -1);
+
+            ImGuiTextBuffer extracted_text;
+            IM_CHECK_EQ(log.ExtractLinesForVerboseLevels(ImGuiTestVerboseLevel_Silent, (ImGuiTestVerboseLevel)level_max, &extracted_text), filtered_n);
+            IM_CHECK_STR_EQ(extracted_text.c_str(), expected_text.c_str());
+        }
+        IM_CHECK(strncmp(log.GetLineBegin(3), "Line 3 level 4\n", 15) == 0);
+        IM_CHECK_EQ(log.GetLineEnd(3) - log.GetLineBegin(3), 14);
+    };
+
+    // ## Test full-text search in logs
+    t = IM_REGISTER_TEST(e, "testengine", "testengine_log_search");
+    t->TestFunc = [](ImGuiTestContext* ctx)
+    {
+        ImGuiTestLog log;
+        auto add_lines = [&](int line_begin, int line_end)
+        {
+            for (int n = line_begin; n < line_end; n++)
+            {
+                const int prev_size = log.Buffer.size();
+                log.Buffer.appendf("[%04d] Item 0x%08X '%s'\n", n, ImHashStr("Item", 0, n), (n % 10 == 0) ? "Tens" : "Other");
+                log.UpdateLineOffsets(ctx->EngineIO, ImGuiTestVerboseLevel_Info, log.Buffer.c_str() + prev_size);
+            }
+        };
+        auto search_linear = [&](const char* query, ImVector<int>* out_lines)
+        {
+            for (int line_idx = 0; line_idx < log.LineInfo.Size; line_idx++)
+                if (ImStristr(log.GetLineBegin(line_idx), log.GetLineEnd(line_idx), query, nullptr))
+                    out_lines->push_back(line_idx);
+        };
+
+        add_lines(0, 500);
+        for (int step = 0; step < 2; step++)
+        {
+            if (step == 1)
+                add_lines(500, 1000); // Index is updated incrementally
+
+            Str64f id_query("0x%08x", ImHashStr("Item", 0, 123)); // Lower-case
+            const char* queries[] = { id_query.c_str(), "tens", "'Other'", "[0042]", "It", "0x", "NotFound", "e" };
+            for (const char* query : queries)
+            {
+                ImVector<int> lines;
+                ImVector<int> lines_expected;
+                log.Search(query, &lines);
+                search_linear(query, &lines_expected);
+                IM_CHECK_EQ_NO_RET(lines.Size, lines_expected.Size);
+                IM_CHECK_NO_RET(lines.Size == 0 || memcmp(lines.Data, lines_expected.Data, (size_t)ImMin(lines.Size, lines_expected.Size) * sizeof(int)) == 0);
+            }
+
+            ImVector<int> lines;
+            IM_CHECK_EQ(log.Search(id_query.c_str(), &lines), 1);
+            IM_CHECK_EQ(lines[0], 123);
+            IM_CHECK_EQ(log.Search("Tens", &lines), (step == 0) ? 50 : 100);
+        }
+        IM_CHECK_EQ(log.SearchIndexLines, 1000);
+        IM_CHECK_EQ(log.SearchIndex.Size, 1000 * IMGUI_TEST_LOG_SEARCH_SIGNATURE_SIZE);
+        IM_CHECK_LT(log.SearchIndex.size_in_bytes(), log.Buffer.size()); // Index is smaller than text
+    };
+
+    // ## Test source files cache used to display test sources
+    t = IM_REGISTER_TEST(e, "testengine", "testengine_source_file_cache");
+    t->TestFunc = [](ImGuiTestContext* ctx)
+    {
+        ImGuiTest* test = ctx->Test;
+        if (test->SourceFile == nullptr || !ImFileExist(test->SourceFile))
+        {
+            ctx->LogWarning("Skipped: source file not found.");
+            return;
+        }
+
+        ImSourceFileCache cache;
+        ImSourceFile* file = cache.GetOrLoad(test->SourceFile);
+        IM_CHECK_SILENT(file != nullptr);
+        IM_CHECK(cache.GetOrLoad(test->SourceFile) == file);
+        IM_CHECK_EQ(cache.Files.Size, 1);
+        IM_CHECK(cache.GetOrLoad("this_file_does_not_exist.cpp") == nullptr);
+        IM_CHECK_GE(file->GetLineCount(), test->SourceLine);
+
+        const char* line_begin;
+        const char* line_end;
+        IM_CHECK(file->GetLines(test->SourceLine, test->SourceLine, &line_begin, &line_end));
+        IM_CHECK(ImStristr(line_begin, line_end, "testengine_source_file_cache", nullptr) != nullptr);
+        IM_CHECK(memchr(line_begin, '\n', (size_t)(line_end - line_begin)) == nullptr);
+        IM_CHECK(!file->GetLines(file->GetLineCount() + 1, file->GetLineCount() + 10, &line_begin, &line_end));
+
+        // Modified files are reloaded, deleted files are removed from cache
+        const char* filename = "output/testengine_source_file_cache.txt";
+        IM_CHECK_SILENT(ImFileCreateDirectoryChain("output"));
+        const char* contents[] = { "Line 1\nLine 2\n", "Line 1\nLine 2 modified\nLine 3\n" };
+        for (int step = 0; step < 2; step++)
+        {
+            FILE* f = fopen(filename, "wb");
+            IM_CHECK_SILENT(f != nullptr);
+            fwrite(contents[step], 1, strlen(contents[step]), f);
+            fclose(f);
+            ImSourceFile* temp_file = cache.GetOrLoad(filename);
+            IM_CHECK_SILENT(temp_file != nullptr);
+            IM_CHECK_EQ(temp_file->GetLineCount(), step + 2);
+            IM_CHECK(temp_file->GetLines(2, 2, &line_begin, &line_end));
+            const char* expected_line = (step == 0) ? "Line 2" : "Line 2 modified";
+            IM_CHECK(line_end - line_begin == (int)strlen(expected_line) && strncmp(line_begin, expected_line, strlen(expected_line)) == 0);
+        }
+        ImFileDelete(filename);
+        IM_CHECK(cache.GetOrLoad(filename) == nullptr);
+        IM_CHECK_EQ(cache.Files.Size, 1);
+
+        // Files with colliding filename hashes are cached separately
+        const char* colliding_filenames[] = { "output/hash_uablaijhsa.txt", "output/hash_pfcxpytzcn.txt" };
+        IM_CHECK_EQ(ImHashStr(colliding_filenames[0]), ImHashStr(colliding_filenames[1]));
+        for (const char* colliding_filename : colliding_filenames)
+        {
+            FILE* f = fopen(colliding_filename, "wb");
+            IM_CHECK_SILENT(f != nullptr);
+            fputs(colliding_filename, f);
+            fclose(f);
+        }
+        ImSourceFile* colliding_files[2] = { cache.GetOrLoad(colliding_filenames[0]), cache.GetOrLoad(colliding_filenames[1]) };
+        IM_CHECK_SILENT(colliding_files[0] != nullptr && colliding_files[1] != nullptr);
+        IM_CHECK(colliding_files[0] != colliding_files[1]);
+        IM_CHECK_EQ(cache.Files.Size, 3);
+        for (int n = 0; n < 2; n++)
+        {
+            IM_CHECK(cache.GetOrLoad(colliding_filenames[n]) == colliding_files[n]);
+            IM_CHECK(colliding_files[n]->GetLines(1, 1, &line_begin, &line_end));
+            IM_CHECK(line_end - line_begin == (int)strlen(colliding_filenames[n]) && strncmp(line_begin, colliding_filenames[n], strlen(colliding_filenames[n])) == 0);
+            ImFileDelete(colliding_filenames[n]);
+        }
+    };
+
+    // ## Test KeyCharsBatch()/KeyPressBatch() and measure frames spent submitting characters
+    t = IM_REGISTER_TEST(e, "testengine", "testengine_key_chars_batch");
+    struct KeyCharsBatchVars { char Buf[2048] = ""; };
+    t->SetVarsDataType<KeyCharsBatchVars>();
+    t->GuiFunc = [](ImGuiTestContext* ctx)
+    {
+        KeyCharsBatchVars& vars = ctx->GetVars<KeyCharsBatchVars>();
+        ImGui::SetNextWindowSize(ImVec2(400, 200), ImGuiCond_Appearing);
+        ImGui::Begin("Test Window", NULL, ImGuiWindowFlags_NoSavedSettings);
+        ImGui::InputTextMultiline("Field", vars.Buf, IM_COUNTOF(vars.Buf), ImVec2(-FLT_MIN, 150));
+        ImGui::End();
+    };
+    t->TestFunc = [](ImGuiTestContext* ctx)
+    {
+        if (ctx->EngineIO->ConfigRunSpeed != ImGuiTestRunSpeed_Fast)
+            return;
+
+        KeyCharsBatchVars& vars = ctx->GetVars<KeyCharsBatchVars>();
+
+        ctx->SetRef("Test Window");
+        ctx->ItemClick("Field");
+
+        // Characters include new lines and 2-bytes UTF-8 sequences. 1 character per frame uses a shorter text to keep test fast.
+        const int chars_per_frame_list[] = { 0, 1, 100 };
+        const int chars_count_list[] = { 1000, 50, 1000 };
+        int frames[IM_COUNTOF(chars_per_frame_list)];
+        for (int variant = 0; variant < IM_COUNTOF(chars_per_frame_list); variant++)
+        {
+            const int chars_per_frame = chars_per_frame_list[variant];
+            const int chars_count = chars_count_list[variant];
+            ImGuiTextBuffer text;
+            for (int n = 0; n < chars_count; n++)
+            {
+                if ((n % 50) == 49)
+                    text.append("\n");
+                else if ((n % 10) == 9)
+                    text.append("\xC3\xA9"); // U+00E9
+                else
+                    text.appendf("%c", 'a' + (n % 26));
+            }
+
+            ctx->KeyCharsReplace("");
+            IM_CHECK_STR_EQ(vars.Buf, "");
+
+            const int frame_start = ctx->FrameCount;
+            ctx->KeyCharsBatch(text.c_str(), chars_per_frame);
+            frames[variant] = ctx->FrameCount - frame_start;
+            IM_CHECK_STR_EQ(vars.Buf, text.c_str());
+            IM_CHECK_EQ(frames[variant], chars_per_frame > 0 ? (chars_count + chars_per_frame - 1) / chars_per_frame : 1);
+        }
+        ctx->LogInfo("Frames: %d for 1000 chars (all at once), %d for 50 chars (1 per frame), %d for 1000 chars (100 per frame)", frames[0], frames[1], frames[2]);
+
+        // Keys and characters queued together in compressed fast mode
+        const bool backup_coalescing = ctx->EngineIO->ConfigFastInputCoalescing;
+        for (int coalescing = 0; coalescing < 2; coalescing++)
+        {
+            ctx->EngineIO->ConfigFastInputCoalescing = (coalescing != 0);
+            ctx->KeyCharsReplace("abc");
+            IM_CHECK_STR_EQ(vars.Buf, "abc");
+
+            const ImGuiKeyChord keys[] = { ImGuiKey_LeftArrow, ImGuiKey_LeftArrow, ImGuiKey_Backspace };
+            ctx->KeyPressBatch(keys, IM_COUNTOF(keys));
+            IM_CHECK_STR_EQ(vars.Buf, "bc");
+
+            ctx->KeyCharsAppend("d\xC3\xA9f");
+            IM_CHECK_STR_EQ(vars.Buf, "bcd\xC3\xA9f");
+        }
+        ctx->EngineIO->ConfigFastInputCoalescing = backup_coalescing;
+    };
+
+    // ## Test that JUnit export output doesn't depend on number of threads formatting per-test fragments
+    t = IM_REGISTER_TEST(e, "testengine", "testengine_export_junit_threads");
+    t->TestFunc = [](ImGuiTestContext* ctx)
+    {
+        const char* filenames[2] = { "output/testengine_export_junit_1.xml", "output/testengine_export_junit_n.xml" };
+        IM_CHECK_SILENT(ImFileCreateDirectoryChain("output"));
+        ctx->LogWarning("Some <escaped> & \"quoted\" 'log' line"); // Warnings are always exported in <system-err>
+
+        const int backup_threads = ctx->EngineIO->ExportResultsThreads;
+        for (int n = 0; n < 2; n++)
+        {
+            ctx->EngineIO->ExportResultsThreads = (n == 0) ? 1 : 4;
+            const ImU64 t0 = ImTimeGetInMicroseconds();
+            ImGuiTestEngine_ExportEx(ctx->Engine, ImGuiTestEngineExportFormat_JUnitXml, filenames[n]);
+            ctx->LogDebug("Exported in %.2f ms, up to %d thread(s)", (double)(ImTimeGetInMicroseconds() - t0) / 1000.0, ctx->EngineIO->ExportResultsThreads);
+        }
+        ctx->EngineIO->ExportResultsThreads = backup_threads;
+
+        size_t sizes[2] = {};
+        char* data[2] = {};
+        for (int n = 0; n < 2; n++)
+            data[n] = (char*)ImFileLoadToMemory(filenames[n], "rb", &sizes[n], 1);
+        const bool loaded = (data[0] != nullptr && data[1] != nullptr);
+        const bool same_output = loaded && sizes[0] == sizes[1] && memcmp(data[0], data[1], sizes[0]) == 0;
+        const bool has_header = loaded && strncmp(data[0], "<?xml", 5) == 0;
+        const bool has_escaped_line = loaded && strstr(data[0], "Some &lt;escaped&gt; &amp; &quot;quoted&quot; &apos;log&apos; line") != nullptr;
+        for (int n = 0; n < 2; n++)
+        {
+            IM_FREE(data[n]);
+            ImFileDelete(filenames[n]);
+        }
+        IM_CHECK(loaded);
+        IM_CHECK(same_output);
+        IM_CHECK(has_header);
+        IM_CHECK(has_escaped_line);
+    };
+
+    // ## Smoke test for io.ConfigForkIsolation, run by CI with -fork: both tests log the number of smoke tests which ran before them
+    // in the same process. Forked, each test runs in a fresh copy of the process and logs 0.
+    static int fork_smoke_runs = 0;
+    for (int n = 0; n < 2; n++)
+    {
+        t = IM_REGISTER_TEST(e, "testengine", n == 0 ? "testengine_fork_smoke_1" : "testengine_fork_smoke_2");
+        t->TestFunc = [](ImGuiTestContext* ctx)
+        {
+            ctx->LogInfo("Fork smoke test: %d run(s) before", fork_smoke_runs);
+            fork_smoke_runs++;
+            ctx->Yield(2);
+            if (ctx->EngineIO->ConfigForkIsolation)
+                IM_CHECK_EQ(fork_smoke_runs, 1);    // Runs of other tests didn't leak into this process
+            else
+                IM_CHECK_GE(fork_smoke_runs, 1);
+        };
+    }
+
+    // ## Test io.ConfigForkIsolation reporting a crashing child, run by CI with -fork (batch is then expected to fail).
+    // _1 crashes when forked: parent reports it as an error and keeps running. _2 is forked from parent after that, so it sees _1 result.
+    t = IM_REGISTER_TEST(e, "testengine", "testengine_fork_crash_1");
+    t->TestFunc = [](ImGuiTestContext* ctx)
+    {
+        ctx->Yield();
+        if (ctx->EngineIO->ConfigForkIsolation)
+            abort();
+    };
+    t = IM_REGISTER_TEST(e, "testengine", "testengine_fork_crash_2");
+    t->TestFunc = [](ImGuiTestContext* ctx)
+    {
+        ImGuiTest* crash_test = ImGuiTestEngine_FindTestByName(ctx->Engine, "testengine", "testengine_fork_crash_1");
+        IM_CHECK_NO_RET(crash_test != NULL);
+        if (!ctx->EngineIO->ConfigForkIsolation || crash_test == NULL || crash_test->Output.Status == ImGuiTestStatus_Unknown)
+        {
+            ctx->LogInfo("Skipped: requires io.ConfigForkIsolation and running testengine_fork_crash_1 first.");
+            return;
+        }
+        IM_CHECK_EQ(crash_test->Output.Status, ImGuiTestStatus_Error);
+        IM_CHECK(strstr(crash_test->Output.Log.GetText(), "[Fork] Test process crashed with signal") != NULL);
+        ctx->LogInfo("Fork crash test: parent reported '%s'", crash_test->Output.Log.GetText());
+    };
 }
 
 //-------------------------------------------------------------------------
@@ -8,6 +8,7 @@
 #include "imgui_internal.h"
 #include "imgui_test_engine/imgui_te_engine.h"      // IM_REGISTER_TEST()
 #include "imgui_test_engine/imgui_te_context.h"
+#include "imgui_test_engine/imgui_te_utils.h"       // ImHashDecoratedPath()
 #include "imgui_test_engine/thirdparty/Str/Str.h"
 
 // Warnings
@@ -44,6 +45,31 @@ static float RandFloatRange(ImU32& state, float range_min, float range_max)
     return range_min + (range_max - range_min) * u;
 }
 
+// Synthetic cell value for large virtual data sets: nothing is stored, values are derived from row/column indices.
+static ImU32 ClipperPerfGetCellValue(int row, int column)
+{
+    ImU32 state = (ImU32)row * 2654435761u + (ImU32)column * 0x9E3779B9u + 1;
+    return XorShift32(state);
+}
+
+// qsort() doesn't take a user pointer, sort specs are passed through a static.
+static const ImGuiTableSortSpecs* GClipperPerfSortSpecs = NULL;
+
+static int IMGUI_CDECL ClipperPerfCompareRows(const void* lhs, const void* rhs)
+{
+    const int row_a = *(const int*)lhs;
+    const int row_b = *(const int*)rhs;
+    for (int n = 0; n < GClipperPerfSortSpecs->SpecsCount; n++)
+    {
+        const ImGuiTableColumnSortSpecs* spec = &GClipperPerfSortSpecs->Specs[n];
+        const ImU32 value_a = ClipperPerfGetCellValue(row_a, spec->ColumnIndex);
+        const ImU32 value_b = ClipperPerfGetCellValue(row_b, spec->ColumnIndex);
+        if (value_a != value_b)
+            return ((value_a < value_b) == (spec->SortDirection == ImGuiSortDirection_Ascending)) ? -1 : +1;
+    }
+    return row_a - row_b;
+}
+
 
 void RegisterTests_Perf(ImGuiTestEngine* e)
 {
@@ -882,6 +908,201 @@ void RegisterTests_Perf(ImGuiTestEngine* e)
     t->GuiFunc = TablePerfFunc;
     t->TestFunc = PerfCaptureFunc;
 
+    // Shared functions to test large virtualized tables and lists using ImGuiListClipper.
+    // Data is virtual (see ClipperPerfGetCellValue()), only the sorted order and selection are stored.
+    struct ClipperPerfFuncVars
+    {
+        int                         RowsCount = 100000;
+        int                         ColumnsCount = 8;       // 0: use a list instead of a table.
+        int                         FreezeColumns = 0;      // > 0: enable horizontal scrolling with frozen columns.
+        int                         SortSpecsCount = 0;     // > 0: number of columns sorted by default.
+        int                         ScrollStepRows = 0;     // Rows scrolled per frame while ScrollEnabled is set, so clipper steps through a new range every frame.
+        bool                        ScrollEnabled = false;  // Set by TestFunc before capture.
+        bool                        SortEveryFrame = false; // Set by TestFunc before capture: handle a sort request every frame.
+        bool                        MultiSelect = false;
+        ImGuiID                     FirstRowID = 0;
+        ImVector<int>               SortedRows;
+        ImGuiSelectionBasicStorage  Selection;
+    };
+    auto ClipperPerfGuiFunc = [](ImGuiTestContext* ctx)
+    {
+        auto& vars = ctx->GetVars<ClipperPerfFuncVars>();
+        ImGui::SetNextWindowSize(ImVec2(800, 600));
+        ImGui::Begin("Test Func", NULL, ImGuiWindowFlags_NoSavedSettings);
+        if (ctx->IsFirstGuiFrame())
+            ctx->LogDebug("%d rows x %d columns, freeze %d, sort %d, multi-select %d, scroll step %d",
+                vars.RowsCount, vars.ColumnsCount, vars.FreezeColumns, vars.SortSpecsCount, vars.MultiSelect, vars.ScrollStepRows);
+        if (vars.SortedRows.Size != vars.RowsCount)
+        {
+            vars.SortedRows.resize(vars.RowsCount);
+            for (int n = 0; n < vars.RowsCount; n++)
+                vars.SortedRows[n] = n;
+        }
+
+        const bool use_table = vars.ColumnsCount > 0;
+        ImGuiTableFlags table_flags = ImGuiTableFlags_ScrollY | ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersOuter | ImGuiTableFlags_BordersV | ImGuiTableFlags_Resizable | ImGuiTableFlags_Reorderable | ImGuiTableFlags_Hideable;
+        if (vars.FreezeColumns > 0)
+            table_flags |= ImGuiTableFlags_ScrollX;
+        if (vars.SortSpecsCount > 0)
+            table_flags |= ImGuiTableFlags_Sortable | ImGuiTableFlags_SortMulti;
+        if (use_table ? ImGui::BeginTable("table1", vars.ColumnsCount, table_flags) : ImGui::BeginChild("list1"))
+        {
+            if (use_table)
+            {
+                ImGui::TableSetupScrollFreeze(vars.FreezeColumns, 1);
+                for (int column_n = 0; column_n < vars.ColumnsCount; column_n++)
+                {
+                    ImGuiTableColumnFlags column_flags = (column_n == 0) ? ImGuiTableColumnFlags_NoHide : ImGuiTableColumnFlags_None;
+                    if (column_n >= 1 && column_n <= vars.SortSpecsCount)
+                        column_flags |= ImGuiTableColumnFlags_DefaultSort;
+                    if (vars.FreezeColumns > 0)
+                        column_flags |= ImGuiTableColumnFlags_WidthFixed;
+                    ImGui::TableSetupColumn(Str16f("Column %d", column_n).c_str(), column_flags, (vars.FreezeColumns > 0) ? 80.0f : 0.0f);
+                }
+                ImGui::TableHeadersRow();
+
+                if (ImGuiTableSortSpecs* sort_specs = ImGui::TableGetSortSpecs())
+                    if (sort_specs->SpecsDirty || vars.SortEveryFrame)
+                    {
+                        GClipperPerfSortSpecs = sort_specs;
+                        qsort(vars.SortedRows.Data, (size_t)vars.SortedRows.Size, sizeof(vars.SortedRows.Data[0]), ClipperPerfCompareRows);
+                        GClipperPerfSortSpecs = NULL;
+                        sort_specs->SpecsDirty = false;
+                    }
+            }
+
+            // Selection is stored by row index, while multi-select API operates on display order.
+            ImGuiMultiSelectIO* ms_io = NULL;
+            if (vars.MultiSelect)
+            {
+                vars.Selection.UserData = &vars;
+                vars.Selection.AdapterIndexToStorageId = [](ImGuiSelectionBasicStorage* self, int idx) { return (ImGuiID)((ClipperPerfFuncVars*)self->UserData)->SortedRows[idx]; };
+                ms_io = ImGui::BeginMultiSelect(ImGuiMultiSelectFlags_ClearOnEscape, vars.Selection.Size, vars.RowsCount);
+                vars.Selection.ApplyRequests(ms_io);
+            }
+
+            ImGuiListClipper clipper;
+            clipper.Begin(vars.RowsCount);
+            if (ms_io && ms_io->RangeSrcItem != -1)
+                clipper.IncludeItemByIndex((int)ms_io->RangeSrcItem);
+            while (clipper.Step())
+            {
+                for (int row_n = clipper.DisplayStart; row_n < clipper.DisplayEnd; row_n++)
+                {
+                    const int row = vars.SortedRows[row_n];
+                    if (use_table)
+                    {
+                        ImGui::TableNextRow();
+                        ImGui::TableNextColumn();
+                    }
+                    if (vars.MultiSelect)
+                    {
+                        ImGui::SetNextItemSelectionUserData(row_n);
+                        ImGui::Selectable(Str16f("%d", row).c_str(), vars.Selection.Contains((ImGuiID)row), ImGuiSelectableFlags_SpanAllColumns);
+                        if (row_n == 0)
+                            vars.FirstRowID = ImGui::GetItemID();
+                    }
+                    else
+                    {
+                        ImGui::Text("%d", row);
+                    }
+                    if (use_table)
+                    {
+                        for (int column_n = 1; column_n < vars.ColumnsCount; column_n++)
+                            if (ImGui::TableNextColumn())
+                                ImGui::Text("%08X", ClipperPerfGetCellValue(row, column_n));
+                    }
+                    else
+                    {
+                        ImGui::SameLine();
+                        ImGui::Text("%08X", ClipperPerfGetCellValue(row, 1));
+                    }
+                }
+            }
+
+            if (vars.MultiSelect)
+            {
+                ms_io = ImGui::EndMultiSelect();
+                vars.Selection.ApplyRequests(ms_io);
+            }
+
+            // Wrap around at the end, so scrolling never stalls.
+            if (vars.ScrollEnabled && vars.ScrollStepRows > 0)
+            {
+                const float scroll_y = ImGui::GetScrollY() + vars.ScrollStepRows * clipper.ItemsHeight;
+                ImGui::SetScrollY(scroll_y > ImGui::GetScrollMaxY() ? 0.0f : scroll_y);
+            }
+
+            if (use_table)
+                ImGui::EndTable();
+        }
+        if (!use_table)
+            ImGui::EndChild();
+        ImGui::End();
+    };
+    auto ClipperPerfTestFunc = [](ImGuiTestContext* ctx)
+    {
+        auto& vars = ctx->GetVars<ClipperPerfFuncVars>();
+        if (vars.MultiSelect)
+        {
+            // Select all rows through multi-select API
+            ctx->ItemClick(vars.FirstRowID);
+            ctx->KeyPress(ImGuiMod_Ctrl | ImGuiKey_A);
+            IM_CHECK_EQ(vars.Selection.Size, vars.RowsCount);
+        }
+        vars.ScrollEnabled = true;
+        vars.SortEveryFrame = (vars.SortSpecsCount > 0);
+        ctx->PerfCapture();
+    };
+
+    // ## Measure the cost of a huge clipped table: many rows, idle
+    t = IM_REGISTER_TEST(e, "perf", "perf_tables_clipper_rows_hi");
+    t->SetVarsDataType<ClipperPerfFuncVars>([](ImGuiTestContext* ctx, auto& vars) { vars.RowsCount = 200000 * ctx->PerfStressAmount; });
+    t->GuiFunc = ClipperPerfGuiFunc;
+    t->TestFunc = ClipperPerfTestFunc;
+
+    // ## Measure the cost of a huge clipped table: many rows, scrolling a few rows every frame
+    t = IM_REGISTER_TEST(e, "perf", "perf_tables_clipper_rows_hi_scroll");
+    t->SetVarsDataType<ClipperPerfFuncVars>([](ImGuiTestContext* ctx, auto& vars) { vars.RowsCount = 200000 * ctx->PerfStressAmount; vars.ScrollStepRows = 7; });
+    t->GuiFunc = ClipperPerfGuiFunc;
+    t->TestFunc = ClipperPerfTestFunc;
+
+    // ## Measure the cost of a huge clipped table: many rows, jumping far every frame
+    t = IM_REGISTER_TEST(e, "perf", "perf_tables_clipper_rows_hi_scroll_far");
+    t->SetVarsDataType<ClipperPerfFuncVars>([](ImGuiTestContext* ctx, auto& vars) { vars.RowsCount = 200000 * ctx->PerfStressAmount; vars.ScrollStepRows = vars.RowsCount / 97; });
+    t->GuiFunc = ClipperPerfGuiFunc;
+    t->TestFunc = ClipperPerfTestFunc;
+
+    // ## Measure the cost of a huge clipped table: many rows, many columns, frozen columns, horizontal and vertical scrolling
+    t = IM_REGISTER_TEST(e, "perf", "perf_tables_clipper_cols_hi_frozen_scroll");
+    t->SetVarsDataType<ClipperPerfFuncVars>([](ImGuiTestContext* ctx, auto& vars) { vars.RowsCount = 200000 * ctx->PerfStressAmount; vars.ColumnsCount = 64; vars.FreezeColumns = 2; vars.ScrollStepRows = 7; });
+    t->GuiFunc = ClipperPerfGuiFunc;
+    t->TestFunc = ClipperPerfTestFunc;
+
+    // ## Measure the cost of handling a sort request every frame: one sort column
+    t = IM_REGISTER_TEST(e, "perf", "perf_tables_clipper_sort_1_every_frame");
+    t->SetVarsDataType<ClipperPerfFuncVars>([](ImGuiTestContext* ctx, auto& vars) { vars.RowsCount = 20000 * ctx->PerfStressAmount; vars.SortSpecsCount = 1; });
+    t->GuiFunc = ClipperPerfGuiFunc;
+    t->TestFunc = ClipperPerfTestFunc;
+
+    // ## Measure the cost of handling a sort request every frame: two sort columns
+    t = IM_REGISTER_TEST(e, "perf", "perf_tables_clipper_sort_2_every_frame");
+    t->SetVarsDataType<ClipperPerfFuncVars>([](ImGuiTestContext* ctx, auto& vars) { vars.RowsCount = 20000 * ctx->PerfStressAmount; vars.SortSpecsCount = 2; });
+    t->GuiFunc = ClipperPerfGuiFunc;
+    t->TestFunc = ClipperPerfTestFunc;
+
+    // ## Measure the cost of multi-select over a huge clipped table: all rows selected, scrolling every frame
+    t = IM_REGISTER_TEST(e, "perf", "perf_tables_clipper_multiselect_all_scroll");
+    t->SetVarsDataType<ClipperPerfFuncVars>([](ImGuiTestContext* ctx, auto& vars) { vars.RowsCount = 200000 * ctx->PerfStressAmount; vars.MultiSelect = true; vars.ScrollStepRows = 7; });
+    t->GuiFunc = ClipperPerfGuiFunc;
+    t->TestFunc = ClipperPerfTestFunc;
+
+    // ## Measure the cost of a huge clipped list (no table): many rows, scrolling every frame
+    t = IM_REGISTER_TEST(e, "perf", "perf_list_clipper_rows_hi_scroll");
+    t->SetVarsDataType<ClipperPerfFuncVars>([](ImGuiTestContext* ctx, auto& vars) { vars.RowsCount = 200000 * ctx->PerfStressAmount; vars.ColumnsCount = 0; vars.ScrollStepRows = 7; });
+    t->GuiFunc = ClipperPerfGuiFunc;
+    t->TestFunc = ClipperPerfTestFunc;
+
     // ## Measure the cost of simple ColorEdit4() calls (multi-component, group based widgets are quite heavy)
     t = IM_REGISTER_TEST(e, "perf", "perf_stress_coloredit4");
     t->GuiFunc = [](ImGuiTestContext* ctx)
@@ -953,6 +1174,25 @@ void RegisterTests_Perf(ImGuiTestEngine* e)
     };
     t->TestFunc = PerfCaptureFunc;
 
+    // ## Measure the cost of ImHashDecoratedPath(), used by every ctx->GetID() and by item queries
+    t = IM_REGISTER_TEST(e, "perf", "perf_stress_hash_decorated_path");
+    t->GuiFunc = [](ImGuiTestContext* ctx)
+    {
+        ImGui::Begin("Test Func", NULL, ImGuiWindowFlags_NoSavedSettings | ImGuiWindowFlags_AlwaysAutoResize);
+        ImGui::Text("Hashing..");
+        int loop_count = 5000 * ctx->PerfStressAmount;
+        ImU32 seed = 0;
+        for (int n = 0; n < loop_count; n++)
+        {
+            seed = ImHashDecoratedPath("Hash me tender", NULL, seed);
+            seed = ImHashDecoratedPath("//Dear ImGui Demo/Widgets/Basic/##combo/Some Long Item Label", NULL, seed);
+            seed = ImHashDecoratedPath("Window/Child_1234ABCD/$$(int)42/Button###Stable", NULL, seed);
+            seed = ImHashDecoratedPath("File\\/Open.../Recent", NULL, seed);
+        }
+        ImGui::End();
+    };
+    t->TestFunc = PerfCaptureFunc;
+
     // ## Measure the cost of simple Listbox() calls
     // (this is creating a child window for every non-clipped widget, so doesn't scale very well)
     t = IM_REGISTER_TEST(e, "perf", "perf_stress_list_box");
@@ -1060,6 +1300,150 @@ void RegisterTests_Perf(ImGuiTestEngine* e)
     };
     t->TestFunc = PerfCaptureFunc;
 
+#ifdef IMGUI_HAS_DOCK
+    // Shared functions to test docking and multi-viewports performances.
+    // Layouts are built once with DockBuilder API, then windows are submitted every frame.
+    struct DockingPerfFuncVars
+    {
+        int         DockTreesCount = 1;         // Number of dock trees. First one is hosted in a dockspace, others are floating nodes.
+        int         DockSplitDepth = 0;         // Each tree is split into 2^depth leaf nodes.
+        int         DockedWindowsCount = 0;     // Windows docked round-robin into leaf nodes of all trees.
+        int         FloatingWindowsCount = 0;   // Undocked windows placed outside of main viewport, each requiring its own viewport.
+        bool        FloatingTreesOutside = false; // Place floating dock trees outside of main viewport.
+        ImGuiID     DockspaceID = 0;
+    };
+    auto DockingPerfGuiFunc = [](ImGuiTestContext* ctx)
+    {
+        auto& vars = ctx->GetVars<DockingPerfFuncVars>();
+        ImGuiViewport* main_viewport = ImGui::GetMainViewport();
+        vars.DockspaceID = ImHashStr("DockingPerfDockspace");
+
+        if (ctx->IsFirstGuiFrame())
+        {
+            ctx->LogDebug("%d trees, split depth %d, %d docked windows, %d floating windows",
+                vars.DockTreesCount, vars.DockSplitDepth, vars.DockedWindowsCount, vars.FloatingWindowsCount);
+
+            ImVector<ImGuiID> root_nodes;
+            ImVector<ImGuiID> leaf_nodes;
+            for (int tree_n = 0; tree_n < vars.DockTreesCount; tree_n++)
+            {
+                ImGuiID root_id;
+                if (tree_n == 0)
+                {
+                    root_id = vars.DockspaceID;
+                    ImGui::DockBuilderRemoveNode(root_id);
+                    ImGui::DockBuilderAddNode(root_id, ImGuiDockNodeFlags_DockSpace);
+                    ImGui::DockBuilderSetNodeSize(root_id, main_viewport->WorkSize - ImVec2(40, 40));
+                }
+                else
+                {
+                    const ImVec2 origin = vars.FloatingTreesOutside ? ImVec2(main_viewport->Size.x + 20.0f, 0.0f) : ImVec2(40.0f, 40.0f);
+                    root_id = ImGui::DockBuilderAddNode(0, ImGuiDockNodeFlags_None);
+                    ImGui::DockBuilderSetNodePos(root_id, main_viewport->Pos + origin + ImVec2((tree_n - 1) * 820.0f, 0.0f));
+                    ImGui::DockBuilderSetNodeSize(root_id, ImVec2(800, 600));
+                }
+                root_nodes.push_back(root_id);
+
+                // Split breadth-first, alternating split direction with depth.
+                ImVector<ImGuiID> nodes;
+                nodes.push_back(root_id);
+                for (int depth = 0; depth < vars.DockSplitDepth; depth++)
+                {
+                    ImVector<ImGuiID> child_nodes;
+                    for (ImGuiID node_id : nodes)
+                    {
+                        ImGuiID node_a = 0, node_b = 0;
+                        ImGui::DockBuilderSplitNode(node_id, (depth & 1) ? ImGuiDir_Up : ImGuiDir_Left, 0.5f, &node_a, &node_b);
+                        child_nodes.push_back(node_a);
+                        child_nodes.push_back(node_b);
+                    }
+                    nodes.swap(child_nodes);
+                }
+                for (ImGuiID node_id : nodes)
+                    leaf_nodes.push_back(node_id);
+            }
+            for (int window_n = 0; window_n < vars.DockedWindowsCount; window_n++)
+                ImGui::DockBuilderDockWindow(Str16f("Docked %04d", window_n).c_str(), leaf_nodes[window_n % leaf_nodes.Size]);
+            for (ImGuiID root_id : root_nodes)
+                ImGui::DockBuilderFinish(root_id);
+        }
+
+        ImGui::SetNextWindowPos(main_viewport->WorkPos + ImVec2(20, 20));
+        ImGui::SetNextWindowSize(main_viewport->WorkSize - ImVec2(40, 40));
+        ImGui::Begin("Test Func", NULL, ImGuiWindowFlags_NoSavedSettings | ImGuiWindowFlags_NoTitleBar);
+        ImGui::DockSpace(vars.DockspaceID);
+        ImGui::End();
+
+        for (int window_n = 0; window_n < vars.DockedWindowsCount; window_n++)
+        {
+            ImGui::Begin(Str16f("Docked %04d", window_n).c_str(), NULL, ImGuiWindowFlags_NoSavedSettings);
+            ImGui::Text("Window %d", window_n);
+            ImGui::Button("Button");
+            ImGui::End();
+        }
+        for (int window_n = 0; window_n < vars.FloatingWindowsCount; window_n++)
+        {
+            ImGui::SetNextWindowPos(main_viewport->Pos + ImVec2(main_viewport->Size.x + 20.0f + (window_n % 10) * 220.0f, (window_n / 10) * 140.0f), ImGuiCond_Appearing);
+            ImGui::SetNextWindowSize(ImVec2(200, 120), ImGuiCond_Appearing);
+            ImGui::Begin(Str16f("Floating %04d", window_n).c_str(), NULL, ImGuiWindowFlags_NoSavedSettings);
+            ImGui::Text("Window %d", window_n);
+            ImGui::Button("Button");
+            ImGui::End();
+        }
+    };
+    auto DockingPerfTestFunc = [](ImGuiTestContext* ctx)
+    {
+        auto& vars = ctx->GetVars<DockingPerfFuncVars>();
+        if (vars.DockedWindowsCount > 0)
+        {
+            ImGuiWindow* window = ctx->GetWindowByRef("Docked 0000");
+            IM_CHECK_SILENT(window != NULL && window->DockNode != NULL);
+        }
+#ifdef IMGUI_HAS_VIEWPORT
+        if (vars.FloatingWindowsCount > 0 || vars.FloatingTreesOutside)
+            IM_CHECK_SILENT(ctx->UiContext->Viewports.Size > 1);
+        ctx->LogDebug("%d viewports", ctx->UiContext->Viewports.Size);
+#endif
+        ctx->PerfCapture();
+    };
+
+    // ## Measure the cost of a deep dock tree: 2^5 leaf nodes hosted in a dockspace
+    t = IM_REGISTER_TEST(e, "perf", "perf_docking_tree_deep");
+    t->SetVarsDataType<DockingPerfFuncVars>([](ImGuiTestContext* ctx, auto& vars) { vars.DockSplitDepth = 5; vars.DockedWindowsCount = 10 * ctx->PerfStressAmount; });
+    t->GuiFunc = DockingPerfGuiFunc;
+    t->TestFunc = DockingPerfTestFunc;
+
+    // ## Measure the cost of a dock node tab bar with hundreds of tabs
+    t = IM_REGISTER_TEST(e, "perf", "perf_docking_tabs_hi");
+    t->SetVarsDataType<DockingPerfFuncVars>([](ImGuiTestContext* ctx, auto& vars) { vars.DockedWindowsCount = 40 * ctx->PerfStressAmount; });
+    t->GuiFunc = DockingPerfGuiFunc;
+    t->TestFunc = DockingPerfTestFunc;
+
+    // ## Measure the cost of multiple floating dock trees within main viewport
+    t = IM_REGISTER_TEST(e, "perf", "perf_docking_floating_trees");
+    t->SetVarsDataType<DockingPerfFuncVars>([](ImGuiTestContext* ctx, auto& vars) { vars.DockTreesCount = 3; vars.DockSplitDepth = 2; vars.DockedWindowsCount = 8 * ctx->PerfStressAmount; });
+    t->GuiFunc = DockingPerfGuiFunc;
+    t->TestFunc = DockingPerfTestFunc;
+
+#ifdef IMGUI_HAS_VIEWPORT
+    // Require -viewport or -viewport-mock to register those tests (mock backend allows running them headless)
+    if ((ImGui::GetIO().ConfigFlags & ImGuiConfigFlags_ViewportsEnable) && (ImGui::GetIO().BackendFlags & ImGuiBackendFlags_PlatformHasViewports))
+    {
+        // ## Measure the cost of many floating windows each owning a viewport
+        t = IM_REGISTER_TEST(e, "perf", "perf_viewports_floating_windows");
+        t->SetVarsDataType<DockingPerfFuncVars>([](ImGuiTestContext* ctx, auto& vars) { vars.FloatingWindowsCount = 10 * ctx->PerfStressAmount; });
+        t->GuiFunc = DockingPerfGuiFunc;
+        t->TestFunc = DockingPerfTestFunc;
+
+        // ## Measure the cost of an app-like layout spread over multiple viewports: a docked main viewport + 2 floating dock trees in their own viewports
+        t = IM_REGISTER_TEST(e, "perf", "perf_viewports_docked_trees");
+        t->SetVarsDataType<DockingPerfFuncVars>([](ImGuiTestContext* ctx, auto& vars) { vars.DockTreesCount = 3; vars.DockSplitDepth = 3; vars.DockedWindowsCount = 9 * ctx->PerfStressAmount; vars.FloatingTreesOutside = true; });
+        t->GuiFunc = DockingPerfGuiFunc;
+        t->TestFunc = DockingPerfTestFunc;
+    }
+#endif // #ifdef IMGUI_HAS_VIEWPORT
+#endif // #ifdef IMGUI_HAS_DOCK
+
 	// ## Circle segment count comparisons
 	t = IM_REGISTER_TEST(e, "perf", "perf_circle_segment_counts");
 	t->GuiFunc = [](ImGuiTestContext* ctx)